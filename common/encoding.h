@@ -0,0 +1,149 @@
+#ifndef CPP_IMPLEMENTATIONS_ENCODING_H
+#define CPP_IMPLEMENTATIONS_ENCODING_H
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstring>
+#include <exception>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace cpp::optional {
+
+    template <typename T>
+    class Optional;
+
+}
+
+namespace cpp::variant {
+
+    template <typename... Ts>
+    class Variant;
+
+}
+
+namespace cpp {
+
+    class BadEncoding : public std::exception {
+    public:
+        BadEncoding() noexcept = default;
+
+        explicit BadEncoding(const char* message) noexcept : message_(message) {}
+
+        [[nodiscard]] const char* what() const noexcept override {
+            return message_;
+        }
+
+    private:
+        const char* message_ = "Bad encoding";
+    };
+
+    namespace details {
+
+        template <typename T>
+        inline constexpr bool kHasOwnEncoding = false;
+
+        template <typename T>
+        inline constexpr bool kHasOwnEncoding<optional::Optional<T>> = true;
+
+        template <typename... Ts>
+        inline constexpr bool kHasOwnEncoding<variant::Variant<Ts...>> = true;
+
+    } // End of namespace details
+
+    // Binary encoding of a value, shared by Optional and Variant, so they can be nested into each other.
+    // Trivially copyable types are stored as their bytes, specializations describe the encoding of other types:
+    // Size returns the number of bytes of the encoding of the value, Write stores them and returns the end,
+    // EncodedSize checks the encoded bytes and returns their number, View reads the value in place
+    // and Read decodes it.
+    template <typename T>
+    struct EncodingTraits {
+        static_assert(!details::kHasOwnEncoding<T>,
+                "Optional and Variant are encoded by optional_serialization.h and variant_serialization.h, include the header");
+        static_assert(std::is_trivially_copyable_v<T>, "Types that are not trivially copyable require a specialization of EncodingTraits");
+
+        using View = T;
+
+        static constexpr size_t Size(const T&) noexcept {
+            return sizeof(T);
+        }
+
+        static std::byte* Write(const T& value, std::byte* data) noexcept {
+            std::memcpy(data, std::addressof(value), sizeof(T));
+            return data + sizeof(T);
+        }
+
+        static size_t EncodedSize(const std::byte*, size_t available) {
+            if (available < sizeof(T)) {
+                throw BadEncoding("Encoded value is truncated");
+            }
+            return sizeof(T);
+        }
+
+        static T Read(const std::byte* data) noexcept {
+            // Copying into a value is faster than std::bit_cast of a byte array, which is left for types without a default constructor
+            if constexpr (std::is_default_constructible_v<T>) {
+                T value;
+                std::memcpy(std::addressof(value), data, sizeof(T));
+                return value;
+            } else {
+                std::array<std::byte, sizeof(T)> bytes;
+                std::memcpy(bytes.data(), data, sizeof(T));
+                return std::bit_cast<T>(bytes);
+            }
+        }
+
+        static View MakeView(const std::byte* data) noexcept {
+            return Read(data);
+        }
+    };
+
+
+    // Appends the encoding of the value to the buffer
+    template <typename T>
+    void Serialize(const T& value, std::vector<std::byte>& buffer);
+
+
+    // Reads the values written one after another by Serialize. The encoding of every value is checked
+    // before its view is returned, BadEncoding is thrown for invalid or truncated data.
+    template <typename T>
+    class EncodedReader {
+    public:
+        using View = typename EncodingTraits<T>::View;
+
+        explicit EncodedReader(std::span<const std::byte> data) noexcept : data_(data) {}
+
+        [[nodiscard]] bool IsEmpty() const noexcept {
+            return data_.empty();
+        }
+
+        // Returns the view of the next value and moves past it
+        View Next();
+
+    private:
+        std::span<const std::byte> data_;
+    };
+
+
+    // Implementation
+    template <typename T>
+    void Serialize(const T& value, std::vector<std::byte>& buffer) {
+        const size_t offset = buffer.size();
+        buffer.resize(offset + EncodingTraits<T>::Size(value));
+        EncodingTraits<T>::Write(value, buffer.data() + offset);
+    }
+
+    template <typename T>
+    typename EncodedReader<T>::View EncodedReader<T>::Next() {
+        const size_t size = EncodingTraits<T>::EncodedSize(data_.data(), data_.size());
+        View view = EncodingTraits<T>::MakeView(data_.data());
+        data_ = data_.subspan(size);
+        return view;
+    }
+
+} // End of namespace cpp
+
+#endif //CPP_IMPLEMENTATIONS_ENCODING_H
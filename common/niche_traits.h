@@ -0,0 +1,60 @@
+#ifndef CPP_IMPLEMENTATIONS_NICHE_TRAITS_H
+#define CPP_IMPLEMENTATIONS_NICHE_TRAITS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace cpp {
+
+    // Describes the values of T that valid objects never take (niches). Optional and Variant of a trivially
+    // copyable T with niches store their empty state in a niche instead of a separate flag.
+    // No type has niches by default, they are opted in by a specialization that defines:
+    //   static constexpr size_t kNicheCount;
+    //   static T MakeNiche(size_t niche) noexcept;         the value of the niche, niche < kNicheCount
+    //   static size_t NicheIndex(const T& value) noexcept;  the niche of the value, kNicheCount for a valid value
+    template <typename T>
+    struct NicheTraits {
+        static constexpr size_t kNicheCount = 0;
+    };
+
+    // Opt-in niches for an enumeration with a fixed underlying type whose values
+    // from kFirstNiche to kFirstNiche + Count - 1 are not used:
+    //   template <> struct cpp::NicheTraits<Color> : cpp::EnumNicheTraits<Color, Color(3)> {};
+    template <typename E, E kFirstNiche, size_t Count = 2>
+    struct EnumNicheTraits {
+        using Underlying = std::underlying_type_t<E>;
+
+        static constexpr size_t kNicheCount = Count;
+
+        static constexpr E MakeNiche(size_t niche) noexcept {
+            return static_cast<E>(static_cast<Underlying>(kFirstNiche) + static_cast<Underlying>(niche));
+        }
+
+        static constexpr size_t NicheIndex(E value) noexcept {
+            const auto niche = static_cast<size_t>(static_cast<Underlying>(value) - static_cast<Underlying>(kFirstNiche));
+            return niche < kNicheCount ? niche : kNicheCount;
+        }
+    };
+
+    // Opt-in niches for pointers that are never null: the null pointer and the addresses below alignof(T),
+    // which are not aligned for T. The niches are not constant expressions, so the optionals and variants
+    // of such pointers are not usable in constant evaluation:
+    //   template <> struct cpp::NicheTraits<Node*> : cpp::NonNullNicheTraits<Node> {};
+    template <typename T>
+    struct NonNullNicheTraits {
+        static constexpr size_t kNicheCount = alignof(T);
+
+        static T* MakeNiche(size_t niche) noexcept {
+            return reinterpret_cast<T*>(static_cast<uintptr_t>(niche));
+        }
+
+        static size_t NicheIndex(T* value) noexcept {
+            const auto niche = static_cast<size_t>(reinterpret_cast<uintptr_t>(value));
+            return niche < kNicheCount ? niche : kNicheCount;
+        }
+    };
+
+} // End of namespace cpp
+
+#endif //CPP_IMPLEMENTATIONS_NICHE_TRAITS_H
@@ -0,0 +1,997 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <random>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "intrusive_list.h"
+#include "mpsc_queue.h"
+#include "lru_cache.h"
+#include "hash_table.h"
+#include "timer_wheel.h"
+#include "slist.h"
+#include "node_pool.h"
+#include "concurrent_list.h"
+#include "rb_tree.h"
+
+namespace {
+
+    class NodeTag;
+
+    struct Node : public cpp::intrusive::ListElement<NodeTag> {
+        explicit Node(uint64_t value) : value_(value) {}
+
+        uint64_t value_;
+    };
+
+    constexpr size_t kNodesCount = 1'000'000;
+    constexpr size_t kMovesCount = 20;
+
+    template <typename F>
+    void Measure(const char* name, size_t operations_count, F&& function) {
+        const auto start = std::chrono::steady_clock::now();
+        function();
+        const auto finish = std::chrono::steady_clock::now();
+        const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(finish - start).count();
+        std::cout << name << ": " << elapsed / operations_count << " ns/operation" << std::endl;
+    }
+
+    std::deque<Node> MakeNodes() {
+        std::deque<Node> nodes;
+        for (size_t i = 0; i < kNodesCount; i++) {
+            nodes.emplace_back(i);
+        }
+        return nodes;
+    }
+
+    template <bool ConstantTimeSize>
+    void BenchmarkMoveRange(const char* one_by_one_name, const char* splice_name, const char* range_splice_name) {
+        using List = cpp::intrusive::List<Node, NodeTag, ConstantTimeSize>;
+
+        auto nodes = MakeNodes();
+        List first;
+        List second;
+        for (auto& node : nodes) {
+            first.PushBack(node);
+        }
+
+        Measure(one_by_one_name, kMovesCount, [&] {
+            for (size_t i = 0; i < kMovesCount; i++) {
+                List& from = i % 2 == 0 ? first : second;
+                List& to = i % 2 == 0 ? second : first;
+                while (!from.IsEmpty()) {
+                    Node* node = from.Front();
+                    from.PopFront();
+                    to.PushBack(*node);
+                }
+            }
+        });
+
+        Measure(splice_name, kMovesCount, [&] {
+            for (size_t i = 0; i < kMovesCount; i++) {
+                List& from = i % 2 == 0 ? first : second;
+                List& to = i % 2 == 0 ? second : first;
+                to.Splice(to.cend(), from);
+            }
+        });
+
+        // The overload for a range counts the moved elements if the size is tracked
+        Measure(range_splice_name, kMovesCount, [&] {
+            for (size_t i = 0; i < kMovesCount; i++) {
+                List& from = i % 2 == 0 ? first : second;
+                List& to = i % 2 == 0 ? second : first;
+                to.Splice(to.cend(), from, from.cbegin(), from.cend());
+            }
+        });
+        std::cout << "Size: " << first.Size() + second.Size() << std::endl;
+    }
+
+    void BenchmarkSize() {
+        auto nodes = MakeNodes();
+        cpp::intrusive::List<Node, NodeTag> linear;
+        for (auto& node : nodes) {
+            linear.PushBack(node);
+        }
+        size_t size = 0;
+        Measure("Linear-time Size", kMovesCount, [&] {
+            for (size_t i = 0; i < kMovesCount; i++) {
+                size += linear.Size();
+            }
+        });
+        std::cout << "Size: " << size / kMovesCount << std::endl;
+    }
+
+    constexpr size_t kDestroyedNodesCount = 10'000'000;
+
+    template <cpp::intrusive::LinkMode Mode>
+    struct ModeNode : public cpp::intrusive::ListElement<NodeTag, Mode> {
+        uint64_t value_{0};
+    };
+
+    // The hook before link modes: the destructor always unlinks, even an element that is not linked
+    struct UnconditionalUnlinkNode : public cpp::intrusive::ListElement<NodeTag, cpp::intrusive::LinkMode::kNormal> {
+        ~UnconditionalUnlinkNode() {
+            Unlink();
+        }
+
+        uint64_t value_{0};
+    };
+
+    template <typename T>
+    void BenchmarkDestruction(const char* name) {
+        auto nodes = std::make_unique<T[]>(kDestroyedNodesCount);
+        Measure(name, kDestroyedNodesCount, [&] {
+            nodes.reset();
+        });
+    }
+
+    void BenchmarkLinkModes() {
+        using cpp::intrusive::LinkMode;
+        BenchmarkDestruction<UnconditionalUnlinkNode>("Destroy unlinked, unconditional unlink");
+        BenchmarkDestruction<ModeNode<LinkMode::kAutoUnlink>>("Destroy unlinked, auto-unlink");
+        BenchmarkDestruction<ModeNode<LinkMode::kSafe>>("Destroy unlinked, safe");
+        BenchmarkDestruction<ModeNode<LinkMode::kNormal>>("Destroy unlinked, normal");
+    }
+
+    struct ByValue {
+        bool operator()(const Node& first, const Node& second) const {
+            return first.value_ < second.value_;
+        }
+    };
+
+    // Links the nodes in a random order and gives them random keys
+    void ShuffleList(cpp::intrusive::List<Node, NodeTag>& list, std::deque<Node>& nodes, std::mt19937_64& generator) {
+        std::vector<Node*> order;
+        for (auto& node : nodes) {
+            node.value_ = generator() % kNodesCount;
+            order.push_back(&node);
+        }
+        std::shuffle(order.begin(), order.end(), generator);
+        for (Node* node : order) {
+            list.PushBack(*node);
+        }
+    }
+
+    void BenchmarkSort() {
+        auto nodes = MakeNodes();
+        std::mt19937_64 generator{42};
+        cpp::intrusive::List<Node, NodeTag> list;
+
+        ShuffleList(list, nodes, generator);
+        Measure("Sort by relinking", kNodesCount, [&] {
+            list.Sort(ByValue{});
+        });
+        while (!list.IsEmpty()) {
+            list.PopFront();
+        }
+
+        ShuffleList(list, nodes, generator);
+        Measure("Sort by copying to vector", kNodesCount, [&] {
+            std::vector<Node*> sorted;
+            for (auto& node : list) {
+                sorted.push_back(&node);
+            }
+            std::stable_sort(sorted.begin(), sorted.end(), [](const Node* first, const Node* second) {
+                return ByValue{}(*first, *second);
+            });
+            while (!list.IsEmpty()) {
+                list.PopFront();
+            }
+            for (Node* node : sorted) {
+                list.PushBack(*node);
+            }
+        });
+        while (!list.IsEmpty()) {
+            list.PopFront();
+        }
+    }
+
+    class ScatteredTag;
+
+    struct ScatteredNode : public cpp::intrusive::ListElement<ScatteredTag> {
+        uint64_t value_{0};
+        const uint64_t* payload_{nullptr};
+    };
+
+    constexpr size_t kPayloadSize = 8;
+    constexpr size_t kTraversalsCount = 5;
+
+    template <typename F>
+    void MeasureTraversals(const char* name, F&& traverse) {
+        uint64_t sum = 0;
+        Measure(name, kTraversalsCount * kNodesCount, [&] {
+            for (size_t i = 0; i < kTraversalsCount; i++) {
+                sum += traverse();
+            }
+        });
+        std::cout << "Sum: " << sum << std::endl;
+    }
+
+    void BenchmarkPrefetch() {
+        using ScatteredList = cpp::intrusive::List<ScatteredNode, ScatteredTag>;
+
+        // Every node and payload is a separate allocation, and the nodes are linked in a random order
+        std::mt19937_64 generator{42};
+        std::vector<std::unique_ptr<ScatteredNode>> nodes;
+        std::vector<std::unique_ptr<uint64_t[]>> payloads;
+        for (size_t i = 0; i < kNodesCount; i++) {
+            nodes.push_back(std::make_unique<ScatteredNode>());
+            payloads.push_back(std::make_unique<uint64_t[]>(kPayloadSize));
+            nodes.back()->value_ = i;
+            payloads.back()[0] = i;
+            nodes.back()->payload_ = payloads.back().get();
+        }
+        std::shuffle(nodes.begin(), nodes.end(), generator);
+        ScatteredList list;
+        for (auto& node : nodes) {
+            list.PushBack(*node);
+        }
+
+        MeasureTraversals("Range-for", [&] {
+            uint64_t sum = 0;
+            for (const auto& node : list) {
+                sum += node.value_;
+            }
+            return sum;
+        });
+        for (size_t distance : {2, 4, 8, 16}) {
+            const std::string name = "ForEachPrefetch distance=" + std::to_string(distance);
+            MeasureTraversals(name.c_str(), [&] {
+                uint64_t sum = 0;
+                list.ForEachPrefetch([&sum](const ScatteredNode& node) { sum += node.value_; }, distance);
+                return sum;
+            });
+        }
+        MeasureTraversals("Prefetching iterator", [&] {
+            uint64_t sum = 0;
+            for (const auto& node : list.Prefetching()) {
+                sum += node.value_;
+            }
+            return sum;
+        });
+
+        MeasureTraversals("Range-for with payload", [&] {
+            uint64_t sum = 0;
+            for (const auto& node : list) {
+                sum += node.payload_[0];
+            }
+            return sum;
+        });
+        MeasureTraversals("ForEachPrefetch with payload", [&] {
+            uint64_t sum = 0;
+            list.ForEachPrefetch([&sum](const ScatteredNode& node) { sum += node.payload_[0]; },
+                                 ScatteredList::kDefaultPrefetchDistance,
+                                 [](const ScatteredNode& node) { return node.payload_; });
+            return sum;
+        });
+
+        while (!list.IsEmpty()) {
+            list.PopFront();
+        }
+    }
+
+    uint64_t SumScattered(cpp::intrusive::List<ScatteredNode, ScatteredTag>& list) {
+        uint64_t sum = 0;
+        for (const auto& node : list) {
+            sum += node.value_;
+        }
+        return sum;
+    }
+
+    void BenchmarkNodePool() {
+        std::mt19937_64 generator{42};
+        std::vector<size_t> order(kNodesCount);
+        for (size_t i = 0; i < kNodesCount; i++) {
+            order[i] = i;
+        }
+        std::shuffle(order.begin(), order.end(), generator);
+
+        {
+            std::vector<ScatteredNode*> nodes(kNodesCount);
+            Measure("new", kNodesCount, [&] {
+                for (auto& node : nodes) {
+                    node = new ScatteredNode();
+                }
+            });
+            cpp::intrusive::List<ScatteredNode, ScatteredTag> list;
+            for (size_t i : order) {
+                nodes[i]->value_ = i;
+                list.PushBack(*nodes[i]);
+            }
+            MeasureTraversals("Traverse new-allocated nodes", [&] {
+                return SumScattered(list);
+            });
+            Measure("delete", kNodesCount, [&] {
+                for (size_t i : order) {
+                    delete nodes[i];
+                }
+            });
+        }
+
+        {
+            cpp::intrusive::NodePool<ScatteredNode> pool;
+            std::vector<ScatteredNode*> nodes(kNodesCount);
+            Measure("NodePool::Create", kNodesCount, [&] {
+                for (auto& node : nodes) {
+                    node = pool.Create();
+                }
+            });
+            cpp::intrusive::List<ScatteredNode, ScatteredTag> list;
+            for (size_t i : order) {
+                nodes[i]->value_ = i;
+                list.PushBack(*nodes[i]);
+            }
+            MeasureTraversals("Traverse pooled nodes", [&] {
+                return SumScattered(list);
+            });
+            Measure("NodePool::Compact", kNodesCount, [&] {
+                cpp::intrusive::NodePool<ScatteredNode>::Compact(list);
+            });
+            MeasureTraversals("Traverse pooled nodes after Compact", [&] {
+                return SumScattered(list);
+            });
+            Measure("NodePool::Destroy", kNodesCount, [&] {
+                for (size_t i : order) {
+                    pool.Destroy(nodes[i]);
+                }
+            });
+            Measure("NodePool recycled Create", kNodesCount, [&] {
+                for (auto& node : nodes) {
+                    node = pool.Create();
+                }
+            });
+            for (auto node : nodes) {
+                pool.Destroy(node);
+            }
+        }
+    }
+
+    struct SNode : public cpp::intrusive::SListElement<NodeTag> {
+        explicit SNode(uint64_t value) : value_(value) {}
+
+        uint64_t value_;
+    };
+
+    constexpr size_t kPushPopRoundsCount = 10;
+
+    // Pushes all nodes and pops them back kPushPopRoundsCount times
+    template <typename Nodes, typename Push, typename Pop>
+    void BenchmarkPushPop(const char* name, Nodes& nodes, Push&& push, Pop&& pop) {
+        uint64_t sum = 0;
+        Measure(name, 2 * kPushPopRoundsCount * nodes.size(), [&] {
+            for (size_t round = 0; round < kPushPopRoundsCount; round++) {
+                for (auto& node : nodes) {
+                    push(node);
+                }
+                for (size_t i = 0; i < nodes.size(); i++) {
+                    sum += pop()->value_;
+                }
+            }
+        });
+        std::cout << "Sum: " << sum << std::endl;
+    }
+
+    void BenchmarkSingleLinks() {
+        std::cout << "Node size: list " << sizeof(Node) << " bytes, singly linked list " << sizeof(SNode) << " bytes" << std::endl;
+
+        auto nodes = MakeNodes();
+        std::deque<SNode> snodes;
+        for (size_t i = 0; i < kNodesCount; i++) {
+            snodes.emplace_back(i);
+        }
+
+        {
+            cpp::intrusive::List<Node, NodeTag> list;
+            BenchmarkPushPop("List as stack", nodes, [&](Node& node) { list.PushFront(node); }, [&] {
+                Node* node = list.Front();
+                list.PopFront();
+                return node;
+            });
+            BenchmarkPushPop("List as queue", nodes, [&](Node& node) { list.PushBack(node); }, [&] {
+                Node* node = list.Front();
+                list.PopFront();
+                return node;
+            });
+        }
+        {
+            cpp::intrusive::Stack<SNode, NodeTag> stack;
+            BenchmarkPushPop("Stack", snodes, [&](SNode& node) { stack.Push(node); }, [&] {
+                return stack.Pop();
+            });
+        }
+        {
+            cpp::intrusive::SList<SNode, NodeTag, true> queue;
+            BenchmarkPushPop("Singly linked list as queue", snodes, [&](SNode& node) { queue.PushBack(node); }, [&] {
+                SNode* node = queue.Front();
+                queue.PopFront();
+                return node;
+            });
+        }
+    }
+
+
+    class QueueTag;
+
+    struct Task : public cpp::intrusive::MpscQueueElement<QueueTag>, public cpp::intrusive::ListElement<QueueTag> {
+        uint64_t value_{0};
+    };
+
+    constexpr size_t kTasksPerProducer = 200'000;
+
+    template <typename Push, typename TryPop>
+    void BenchmarkProducers(const char* name, size_t producers_count, Push&& push, TryPop&& try_pop) {
+        std::deque<Task> tasks(producers_count * kTasksPerProducer);
+
+        const auto start = std::chrono::steady_clock::now();
+        std::vector<std::thread> producers;
+        for (size_t i = 0; i < producers_count; i++) {
+            producers.emplace_back([&tasks, &push, i] {
+                for (size_t j = i * kTasksPerProducer; j < (i + 1) * kTasksPerProducer; j++) {
+                    tasks[j].value_ = j;
+                    push(tasks[j]);
+                }
+            });
+        }
+
+        uint64_t sum = 0;
+        for (size_t popped = 0; popped < tasks.size();) {
+            if (Task* task = try_pop()) {
+                sum += task->value_;
+                ++popped;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+        for (auto& producer : producers) {
+            producer.join();
+        }
+        const auto finish = std::chrono::steady_clock::now();
+
+        const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(finish - start).count();
+        std::cout << name << " producers=" << producers_count << ": "
+                  << elapsed / static_cast<int64_t>(tasks.size()) << " ns/task, sum=" << sum << std::endl;
+    }
+
+    void BenchmarkQueues() {
+        const size_t max_producers_count = std::max(std::thread::hardware_concurrency(), 4u);
+
+        for (size_t producers_count = 1; producers_count <= max_producers_count; producers_count *= 2) {
+            std::mutex mutex;
+            cpp::intrusive::List<Task, QueueTag> list;
+            BenchmarkProducers("Mutex-guarded List", producers_count,
+                [&](Task& task) {
+                    std::lock_guard lock(mutex);
+                    list.PushBack(task);
+                },
+                [&]() -> Task* {
+                    std::lock_guard lock(mutex);
+                    if (list.IsEmpty()) {
+                        return nullptr;
+                    }
+                    Task* task = list.Front();
+                    list.PopFront();
+                    return task;
+                });
+        }
+
+        for (size_t producers_count = 1; producers_count <= max_producers_count; producers_count *= 2) {
+            cpp::intrusive::MpscQueue<Task, QueueTag> queue;
+            BenchmarkProducers("MpscQueue", producers_count,
+                [&](Task& task) { queue.Push(task); },
+                [&]() { return queue.TryPop(); });
+        }
+    }
+
+    class SessionTag;
+
+    struct Session : public cpp::intrusive::ConcurrentListElement<SessionTag>, public cpp::intrusive::ListElement<SessionTag> {
+        uint64_t value_{0};
+    };
+
+    constexpr size_t kSessionsPerWorker = 16;
+    constexpr size_t kRelinksPerWorker = 20'000;
+    constexpr size_t kMaxWorkersCount = 64;
+
+    // Every worker links its anchor and keeps relinking its own sessions after it,
+    // while a reaper thread keeps traversing the whole list
+    template <typename Link, typename Relink, typename Traverse>
+    void BenchmarkWorkers(const char* name, std::deque<Session>& sessions, size_t workers_count,
+                          Link&& link, Relink&& relink, Traverse&& traverse) {
+        std::atomic<bool> done{false};
+
+        const auto start = std::chrono::steady_clock::now();
+        std::thread reaper([&] {
+            while (!done.load(std::memory_order_relaxed)) {
+                traverse();
+            }
+        });
+        std::vector<std::thread> workers;
+        for (size_t i = 0; i < workers_count; i++) {
+            workers.emplace_back([&sessions, &link, &relink, i] {
+                Session& anchor = sessions[i * (kSessionsPerWorker + 1)];
+                link(anchor);
+                for (size_t j = 0; j < kRelinksPerWorker; j++) {
+                    relink(anchor, sessions[i * (kSessionsPerWorker + 1) + 1 + j % kSessionsPerWorker]);
+                }
+            });
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+        const auto finish = std::chrono::steady_clock::now();
+        done = true;
+        reaper.join();
+
+        const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(finish - start).count();
+        std::cout << name << " workers=" << workers_count << ": "
+                  << elapsed / static_cast<int64_t>(workers_count * kRelinksPerWorker) << " ns/relink" << std::endl;
+    }
+
+    void BenchmarkConcurrentList() {
+        for (size_t workers_count = 1; workers_count <= kMaxWorkersCount; workers_count *= 2) {
+            std::deque<Session> sessions(workers_count * (kSessionsPerWorker + 1));
+            std::mutex mutex;
+            cpp::intrusive::List<Session, SessionTag> list;
+            uint64_t sum = 0;
+            BenchmarkWorkers("Mutex-guarded List", sessions, workers_count,
+                [&](Session& anchor) {
+                    std::lock_guard lock(mutex);
+                    list.PushBack(anchor);
+                },
+                [&](Session& anchor, Session& session) {
+                    std::lock_guard lock(mutex);
+                    if (session.IsLinked()) {
+                        list.Erase(list.GetIterator(session));
+                    }
+                    list.Insert(std::next(list.GetIterator(anchor)), session);
+                },
+                [&] {
+                    std::lock_guard lock(mutex);
+                    for (const Session& session : list) {
+                        sum += session.value_;
+                    }
+                });
+        }
+
+        for (size_t workers_count = 1; workers_count <= kMaxWorkersCount; workers_count *= 2) {
+            std::deque<Session> sessions(workers_count * (kSessionsPerWorker + 1));
+            cpp::intrusive::ConcurrentList<Session, SessionTag> list;
+            std::atomic<uint64_t> sum{0};
+            BenchmarkWorkers("ConcurrentList", sessions, workers_count,
+                [&](Session& anchor) { list.PushBack(anchor); },
+                [&](Session& anchor, Session& session) {
+                    list.Unlink(session);
+                    list.InsertAfter(anchor, session);
+                },
+                [&] {
+                    uint64_t traversal_sum = 0;
+                    list.ForEach([&](const Session& session) {
+                        traversal_sum += session.value_;
+                    });
+                    sum += traversal_sum;
+                });
+            list.RemoveIf([](const Session&) { return true; });
+        }
+    }
+
+
+    class LruTag;
+
+    struct CacheEntry : public cpp::intrusive::ListElement<LruTag>, public cpp::intrusive::HashElement<LruTag> {
+        uint64_t key_{0};
+        uint64_t value_{0};
+    };
+
+    struct CacheEntryKey {
+        uint64_t operator()(const CacheEntry& entry) const {
+            return entry.key_;
+        }
+    };
+
+    using IntrusiveLru = cpp::intrusive::LruCache<CacheEntry, uint64_t, CacheEntryKey,
+            std::hash<uint64_t>, std::equal_to<uint64_t>, LruTag>;
+
+    // The usual non-intrusive LRU: a list of values and a map from keys to list iterators
+    class MapListLru {
+    public:
+        explicit MapListLru(size_t capacity) : capacity_(capacity) {
+            index_.reserve(capacity);
+        }
+
+        uint64_t* Find(uint64_t key) {
+            auto it = index_.find(key);
+            if (it == index_.end()) {
+                return nullptr;
+            }
+            entries_.splice(entries_.begin(), entries_, it->second);
+            return &it->second->second;
+        }
+
+        void Insert(uint64_t key, uint64_t value) {
+            if (entries_.size() >= capacity_) {
+                index_.erase(entries_.back().first);
+                entries_.pop_back();
+            }
+            entries_.emplace_front(key, value);
+            index_.emplace(key, entries_.begin());
+        }
+
+    private:
+        size_t capacity_;
+        std::list<std::pair<uint64_t, uint64_t>> entries_;
+        std::unordered_map<uint64_t, std::list<std::pair<uint64_t, uint64_t>>::iterator> index_;
+    };
+
+    constexpr size_t kCacheCapacity = 100'000;
+    constexpr size_t kCacheOperationsCount = 1'000'000;
+
+    void BenchmarkLru() {
+        std::mt19937_64 generator{42};
+        std::vector<uint64_t> hit_keys(kCacheOperationsCount);
+        for (auto& key : hit_keys) {
+            key = generator() % kCacheCapacity;
+        }
+
+        {
+            std::deque<CacheEntry> entries(kCacheCapacity);
+            IntrusiveLru cache{kCacheCapacity};
+            CacheEntry* evicted = nullptr;
+            for (size_t i = 0; i < kCacheCapacity; i++) {
+                entries[i].key_ = i;
+                entries[i].value_ = i;
+                cache.Insert(entries[i], evicted);
+            }
+
+            uint64_t sum = 0;
+            Measure("Intrusive LRU hit", kCacheOperationsCount, [&] {
+                for (uint64_t key : hit_keys) {
+                    sum += cache.Find(key)->value_;
+                }
+            });
+            Measure("Intrusive LRU miss", kCacheOperationsCount, [&] {
+                for (uint64_t key : hit_keys) {
+                    sum += cache.Find(key + kCacheCapacity) == nullptr;
+                }
+            });
+            Measure("Intrusive LRU eviction", kCacheOperationsCount, [&] {
+                for (size_t i = 0; i < kCacheOperationsCount; i++) {
+                    CacheEntry* entry = cache.EvictBack();
+                    entry->key_ = kCacheCapacity + i;
+                    cache.Insert(*entry, evicted);
+                }
+            });
+            std::cout << "Sum: " << sum << std::endl;
+
+            while (!cache.IsEmpty()) {
+                cache.EvictBack();
+            }
+        }
+
+        {
+            MapListLru cache{kCacheCapacity};
+            for (size_t i = 0; i < kCacheCapacity; i++) {
+                cache.Insert(i, i);
+            }
+
+            uint64_t sum = 0;
+            Measure("Map+list LRU hit", kCacheOperationsCount, [&] {
+                for (uint64_t key : hit_keys) {
+                    sum += *cache.Find(key);
+                }
+            });
+            Measure("Map+list LRU miss", kCacheOperationsCount, [&] {
+                for (uint64_t key : hit_keys) {
+                    sum += cache.Find(key + kCacheCapacity) == nullptr;
+                }
+            });
+            Measure("Map+list LRU eviction", kCacheOperationsCount, [&] {
+                for (size_t i = 0; i < kCacheOperationsCount; i++) {
+                    cache.Insert(kCacheCapacity + i, i);
+                }
+            });
+            std::cout << "Sum: " << sum << std::endl;
+        }
+    }
+
+
+    class HashTag;
+
+    struct HashEntry : public cpp::intrusive::HashElement<HashTag> {
+        uint64_t key_{0};
+        uint64_t value_{0};
+    };
+
+    struct HashEntryKey {
+        uint64_t operator()(const HashEntry& entry) const {
+            return entry.key_;
+        }
+    };
+
+    using IntrusiveHashMap = cpp::intrusive::HashMap<HashEntry, uint64_t, HashEntryKey,
+            std::hash<uint64_t>, std::equal_to<uint64_t>, HashTag>;
+
+    constexpr size_t kHashEntriesCount = 4'000'000;
+
+    // Prints the throughput and the slowest single insert, which shows the rehashing stall
+    template <typename Insert>
+    void MeasureInserts(const char* name, Insert&& insert) {
+        std::chrono::nanoseconds max_latency{0};
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < kHashEntriesCount; i++) {
+            const auto insert_start = std::chrono::steady_clock::now();
+            insert(i);
+            max_latency = std::max(max_latency, std::chrono::steady_clock::now() - insert_start);
+        }
+        const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+        std::cout << name << ": " << elapsed.count() / kHashEntriesCount << " ns/operation, worst insert "
+                  << std::chrono::duration_cast<std::chrono::microseconds>(max_latency).count() << " us" << std::endl;
+    }
+
+    void BenchmarkHashTables() {
+        std::mt19937_64 generator{42};
+        std::vector<uint64_t> keys(kHashEntriesCount);
+        for (auto& key : keys) {
+            key = generator();
+        }
+
+        {
+            std::deque<HashEntry> entries(kHashEntriesCount);
+            IntrusiveHashMap map;
+            MeasureInserts("Intrusive hash map insert", [&](size_t i) {
+                entries[i].key_ = keys[i];
+                entries[i].value_ = i;
+                map.Insert(entries[i]);
+            });
+
+            uint64_t sum = 0;
+            Measure("Intrusive hash map find", kHashEntriesCount, [&] {
+                for (uint64_t key : keys) {
+                    sum += map.Find(key)->value_;
+                }
+            });
+            Measure("Intrusive hash map erase", kHashEntriesCount, [&] {
+                for (uint64_t key : keys) {
+                    sum += map.Erase(key)->value_;
+                }
+            });
+            std::cout << "Sum: " << sum << std::endl;
+        }
+
+        {
+            std::unordered_map<uint64_t, uint64_t> map;
+            MeasureInserts("std::unordered_map insert", [&](size_t i) {
+                map.emplace(keys[i], i);
+            });
+
+            uint64_t sum = 0;
+            Measure("std::unordered_map find", kHashEntriesCount, [&] {
+                for (uint64_t key : keys) {
+                    sum += map.find(key)->second;
+                }
+            });
+            Measure("std::unordered_map erase", kHashEntriesCount, [&] {
+                for (uint64_t key : keys) {
+                    sum += map.erase(key);
+                }
+            });
+            std::cout << "Sum: " << sum << std::endl;
+        }
+    }
+
+
+    class OrderTag;
+
+    // An order sits in the arrival list and in the price index at once
+    struct Order : public cpp::intrusive::ListElement<OrderTag>, public cpp::intrusive::RbTreeElement<OrderTag> {
+        uint64_t price_{0};
+        uint64_t quantity_{0};
+    };
+
+    struct OrderPrice {
+        uint64_t operator()(const Order& order) const {
+            return order.price_;
+        }
+    };
+
+    using PriceIndex = cpp::intrusive::RbTree<Order, uint64_t, OrderPrice, std::less<uint64_t>, OrderTag>;
+
+    constexpr size_t kOrdersCount = 1'000'000;
+
+    void BenchmarkOrderedIndex() {
+        std::mt19937_64 generator{42};
+        std::vector<uint64_t> prices(kOrdersCount);
+        for (auto& price : prices) {
+            price = generator();
+        }
+        std::vector<uint64_t> queries(kOrdersCount);
+        for (auto& query : queries) {
+            query = generator();
+        }
+        std::deque<Order> orders(kOrdersCount);
+        for (size_t i = 0; i < kOrdersCount; i++) {
+            orders[i].price_ = prices[i];
+            orders[i].quantity_ = i;
+        }
+
+        {
+            cpp::intrusive::List<Order, OrderTag> arrivals;
+            PriceIndex index;
+            Measure("Intrusive RbTree insert", kOrdersCount, [&] {
+                for (Order& order : orders) {
+                    arrivals.PushBack(order);
+                    index.Insert(order);
+                }
+            });
+
+            uint64_t sum = 0;
+            Measure("Intrusive RbTree lower bound", kOrdersCount, [&] {
+                for (uint64_t query : queries) {
+                    auto it = index.LowerBound(query);
+                    sum += it == index.end() ? 0 : it->quantity_;
+                }
+            });
+            Measure("Intrusive RbTree erase", kOrdersCount, [&] {
+                while (!arrivals.IsEmpty()) {
+                    Order& order = *arrivals.Front();
+                    arrivals.PopFront();
+                    index.Erase(order);
+                }
+            });
+            std::cout << "Sum: " << sum << std::endl;
+        }
+
+        {
+            std::list<Order*> arrivals;
+            std::map<uint64_t, Order*> index;
+            Measure("std::map of pointers insert", kOrdersCount, [&] {
+                for (Order& order : orders) {
+                    arrivals.push_back(&order);
+                    index.emplace(order.price_, &order);
+                }
+            });
+
+            uint64_t sum = 0;
+            Measure("std::map of pointers lower bound", kOrdersCount, [&] {
+                for (uint64_t query : queries) {
+                    auto it = index.lower_bound(query);
+                    sum += it == index.end() ? 0 : it->second->quantity_;
+                }
+            });
+            Measure("std::map of pointers erase", kOrdersCount, [&] {
+                while (!arrivals.empty()) {
+                    index.erase(arrivals.front()->price_);
+                    arrivals.pop_front();
+                }
+            });
+            std::cout << "Sum: " << sum << std::endl;
+        }
+    }
+
+
+    class TimerTag;
+
+    struct Timer : public cpp::intrusive::TimerElement<TimerTag> {
+        uint64_t fired_{0};
+    };
+
+    constexpr size_t kTimersCount = 1'000'000;
+    constexpr uint64_t kTimersHorizon = uint64_t{1} << 20;
+
+    // The usual heap of timers: cancellation is lazy, stale entries are skipped when they reach the top
+    class HeapTimers {
+    public:
+        HeapTimers() : deadlines_(kTimersCount, kCancelled) {}
+
+        void Schedule(uint32_t id, uint64_t deadline) {
+            deadlines_[id] = deadline;
+            heap_.emplace(deadline, id);
+        }
+
+        void Cancel(uint32_t id) {
+            deadlines_[id] = kCancelled;
+        }
+
+        template <typename F>
+        void Advance(uint64_t now, F&& on_expire) {
+            while (!heap_.empty() && heap_.top().first <= now) {
+                const auto [deadline, id] = heap_.top();
+                heap_.pop();
+                if (deadlines_[id] == deadline) {
+                    deadlines_[id] = kCancelled;
+                    on_expire(id);
+                }
+            }
+        }
+
+    private:
+        static constexpr uint64_t kCancelled = std::numeric_limits<uint64_t>::max();
+
+        std::vector<uint64_t> deadlines_;
+        std::priority_queue<std::pair<uint64_t, uint32_t>, std::vector<std::pair<uint64_t, uint32_t>>, std::greater<>> heap_;
+    };
+
+    void BenchmarkTimers() {
+        std::mt19937_64 generator{42};
+        std::vector<uint64_t> deadlines(kTimersCount);
+        std::vector<uint32_t> churn_ids(kTimersCount);
+        std::vector<uint64_t> churn_deadlines(kTimersCount);
+        for (size_t i = 0; i < kTimersCount; i++) {
+            deadlines[i] = 1 + generator() % kTimersHorizon;
+            churn_ids[i] = static_cast<uint32_t>(generator() % kTimersCount);
+            churn_deadlines[i] = 1 + generator() % kTimersHorizon;
+        }
+
+        {
+            std::vector<Timer> timers(kTimersCount);
+            cpp::intrusive::TimerWheel<Timer, TimerTag> wheel;
+            Measure("Timer wheel schedule", kTimersCount, [&] {
+                for (size_t i = 0; i < kTimersCount; i++) {
+                    wheel.Schedule(timers[i], deadlines[i]);
+                }
+            });
+            Measure("Timer wheel cancel and reschedule", kTimersCount, [&] {
+                for (size_t i = 0; i < kTimersCount; i++) {
+                    Timer& timer = timers[churn_ids[i]];
+                    wheel.Cancel(timer);
+                    wheel.Schedule(timer, churn_deadlines[i]);
+                }
+            });
+            uint64_t fired = 0;
+            Measure("Timer wheel expire", kTimersCount, [&] {
+                fired = wheel.Advance(kTimersHorizon, [](Timer& timer) { ++timer.fired_; });
+            });
+            std::cout << "Fired: " << fired << std::endl;
+        }
+
+        {
+            HeapTimers heap;
+            Measure("Heap schedule", kTimersCount, [&] {
+                for (size_t i = 0; i < kTimersCount; i++) {
+                    heap.Schedule(static_cast<uint32_t>(i), deadlines[i]);
+                }
+            });
+            Measure("Heap cancel and reschedule", kTimersCount, [&] {
+                for (size_t i = 0; i < kTimersCount; i++) {
+                    heap.Cancel(churn_ids[i]);
+                    heap.Schedule(churn_ids[i], churn_deadlines[i]);
+                }
+            });
+            uint64_t fired = 0;
+            Measure("Heap expire", kTimersCount, [&] {
+                heap.Advance(kTimersHorizon, [&fired](uint32_t) { ++fired; });
+            });
+            std::cout << "Fired: " << fired << std::endl;
+        }
+    }
+
+}
+
+int main() {
+    BenchmarkMoveRange<false>("Move one by one", "Splice", "Splice range");
+    BenchmarkMoveRange<true>("Move one by one (constant-time size)", "Splice (constant-time size)", "Splice range (constant-time size)");
+    BenchmarkSize();
+    BenchmarkLinkModes();
+    BenchmarkSingleLinks();
+    BenchmarkSort();
+    BenchmarkPrefetch();
+    BenchmarkNodePool();
+    BenchmarkQueues();
+    BenchmarkConcurrentList();
+    BenchmarkLru();
+    BenchmarkHashTables();
+    BenchmarkOrderedIndex();
+    BenchmarkTimers();
+    return 0;
+}
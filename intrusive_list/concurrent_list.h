@@ -0,0 +1,298 @@
+#ifndef CPP_IMPLEMENTATIONS_CONCURRENT_LIST_H
+#define CPP_IMPLEMENTATIONS_CONCURRENT_LIST_H
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <thread>
+#include <type_traits>
+#include "intrusive_list.h"
+
+namespace cpp::intrusive {
+
+    template <typename Tag = DefaultTag>
+    class ConcurrentListElement;
+
+    template <typename T, typename Tag>
+    concept IsConcurrentListElement = std::is_base_of_v<ConcurrentListElement<Tag>, T>;
+
+    template <typename T, typename Tag = DefaultTag>
+    requires IsConcurrentListElement<T, Tag>
+    class ConcurrentList;
+
+
+    class ConcurrentListElementBase {
+    protected:
+        ConcurrentListElementBase() = default;
+        ~ConcurrentListElementBase() = default;
+
+    private:
+        void Lock() noexcept;
+        bool TryLock() noexcept;
+        void Unlock() noexcept;
+
+    private:
+        // The links of an element are changed only while the element is locked. An unlinked element has null links.
+        ConcurrentListElementBase* prev_{nullptr};
+        ConcurrentListElementBase* next_{nullptr};
+        std::atomic<bool> locked_{false};
+
+        template <typename T, typename Tag>
+        requires IsConcurrentListElement<T, Tag>
+        friend class ConcurrentList;
+
+    };
+
+    // Unlike ListElement the hook is not unlinked on destruction:
+    // an element must be unlinked from the list before it is destroyed.
+    template <typename Tag>
+    class ConcurrentListElement : private ConcurrentListElementBase {
+    protected:
+        ConcurrentListElement() = default;
+        ~ConcurrentListElement() = default;
+
+    public:
+        ConcurrentListElement(const ConcurrentListElement&) = delete;
+        ConcurrentListElement(const ConcurrentListElement&&) = delete;
+        ConcurrentListElement& operator=(const ConcurrentListElement&) = delete;
+        ConcurrentListElement& operator=(const ConcurrentListElement&&) = delete;
+
+        template <typename T, typename Tag_>
+        requires IsConcurrentListElement<T, Tag_>
+        friend class ConcurrentList;
+
+    };
+
+
+    // Intrusive doubly linked list with a spin lock in every element, so threads that insert and unlink
+    // unrelated elements never contend on a global lock.
+    // Locks are taken from the head to the tail. The only lock taken against this order is the lock of the previous
+    // element, and it is taken with TryLock, so there are no deadlocks. An element cannot be unlinked while
+    // its neighbour is locked, so a thread that holds an element can safely lock its neighbours.
+    template <typename T, typename Tag>
+    requires IsConcurrentListElement<T, Tag>
+    class ConcurrentList {
+    public:
+        ConcurrentList() noexcept;
+
+        ConcurrentList(const ConcurrentList&) = delete;
+        ConcurrentList(ConcurrentList&&) = delete;
+        ConcurrentList& operator=(const ConcurrentList&) = delete;
+        ConcurrentList& operator=(ConcurrentList&&) = delete;
+
+        // The list must be empty
+        ~ConcurrentList() = default;
+
+        void PushFront(T& element) noexcept;
+        void PushBack(T& element) noexcept;
+
+        // Inserts the element after the position. The caller must keep the position linked, e.g. own it.
+        // Threads that insert after different positions do not contend.
+        void InsertAfter(T& position, T& element) noexcept;
+
+        // Returns false if the element is not linked, e.g. it has already been removed by RemoveIf
+        bool Unlink(T& element) noexcept;
+
+        // Calls function(T&) for every element. The element is locked during the call, so it cannot be unlinked;
+        // the function must not insert or unlink elements of this list.
+        template <typename F>
+        void ForEach(F&& function);
+
+        // Unlinks every element for which predicate(T&) returns true and returns the number of unlinked elements.
+        // The predicate must not insert or unlink elements of this list.
+        template <typename Predicate>
+        size_t RemoveIf(Predicate&& predicate);
+
+        [[nodiscard]] bool IsEmpty() noexcept;
+
+    private:
+        // Inserts the new element between the locked neighbours
+        static void LinkBetween(ConcurrentListElementBase* prev, ConcurrentListElementBase* element, ConcurrentListElementBase* next) noexcept;
+
+        static ConcurrentListElementBase* ToConcurrentListElementBase(T& element) noexcept;
+        static T* ToTemplateType(ConcurrentListElementBase* element) noexcept;
+
+        class Sentinel : public ConcurrentListElementBase {};
+
+    private:
+        Sentinel head_{};
+        Sentinel tail_{};
+    };
+
+
+    // Implementation
+    inline void ConcurrentListElementBase::Lock() noexcept {
+        while (!TryLock()) {
+            while (locked_.load(std::memory_order_relaxed)) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    inline bool ConcurrentListElementBase::TryLock() noexcept {
+        return !locked_.load(std::memory_order_relaxed) && !locked_.exchange(true, std::memory_order_acquire);
+    }
+
+    inline void ConcurrentListElementBase::Unlock() noexcept {
+        locked_.store(false, std::memory_order_release);
+    }
+
+    template <typename T, typename Tag>
+    requires IsConcurrentListElement<T, Tag>
+    ConcurrentList<T, Tag>::ConcurrentList() noexcept {
+        head_.next_ = &tail_;
+        tail_.prev_ = &head_;
+    }
+
+    template <typename T, typename Tag>
+    requires IsConcurrentListElement<T, Tag>
+    void ConcurrentList<T, Tag>::PushFront(T& element) noexcept {
+        head_.Lock();
+        ConcurrentListElementBase* const next = head_.next_;
+        next->Lock();
+        LinkBetween(&head_, ToConcurrentListElementBase(element), next);
+        next->Unlock();
+        head_.Unlock();
+    }
+
+    template <typename T, typename Tag>
+    requires IsConcurrentListElement<T, Tag>
+    void ConcurrentList<T, Tag>::PushBack(T& element) noexcept {
+        while (true) {
+            tail_.Lock();
+            ConcurrentListElementBase* const prev = tail_.prev_;
+            if (prev->TryLock()) {
+                LinkBetween(prev, ToConcurrentListElementBase(element), &tail_);
+                prev->Unlock();
+                tail_.Unlock();
+                return;
+            }
+            tail_.Unlock();
+            std::this_thread::yield();
+        }
+    }
+
+    template <typename T, typename Tag>
+    requires IsConcurrentListElement<T, Tag>
+    void ConcurrentList<T, Tag>::InsertAfter(T& position, T& element) noexcept {
+        ConcurrentListElementBase* const position_as_base = ToConcurrentListElementBase(position);
+        position_as_base->Lock();
+        assert(position_as_base->next_ != nullptr);
+        ConcurrentListElementBase* const next = position_as_base->next_;
+        next->Lock();
+        LinkBetween(position_as_base, ToConcurrentListElementBase(element), next);
+        next->Unlock();
+        position_as_base->Unlock();
+    }
+
+    template <typename T, typename Tag>
+    requires IsConcurrentListElement<T, Tag>
+    bool ConcurrentList<T, Tag>::Unlink(T& element) noexcept {
+        ConcurrentListElementBase* const element_as_base = ToConcurrentListElementBase(element);
+        while (true) {
+            element_as_base->Lock();
+            ConcurrentListElementBase* const prev = element_as_base->prev_;
+            if (prev == nullptr) {
+                element_as_base->Unlock();
+                return false;
+            }
+            // prev cannot be unlinked while the element is locked, so it is alive
+            if (prev->TryLock()) {
+                ConcurrentListElementBase* const next = element_as_base->next_;
+                next->Lock();
+                prev->next_ = next;
+                next->prev_ = prev;
+                element_as_base->prev_ = element_as_base->next_ = nullptr;
+                next->Unlock();
+                element_as_base->Unlock();
+                prev->Unlock();
+                return true;
+            }
+            element_as_base->Unlock();
+            std::this_thread::yield();
+        }
+    }
+
+    template <typename T, typename Tag>
+    requires IsConcurrentListElement<T, Tag>
+    template <typename F>
+    void ConcurrentList<T, Tag>::ForEach(F&& function) {
+        ConcurrentListElementBase* prev = &head_;
+        prev->Lock();
+        while (true) {
+            ConcurrentListElementBase* const current = prev->next_;
+            current->Lock();
+            prev->Unlock();
+            if (current == &tail_) {
+                current->Unlock();
+                return;
+            }
+            function(*ToTemplateType(current));
+            prev = current;
+        }
+    }
+
+    template <typename T, typename Tag>
+    requires IsConcurrentListElement<T, Tag>
+    template <typename Predicate>
+    size_t ConcurrentList<T, Tag>::RemoveIf(Predicate&& predicate) {
+        size_t removed_count = 0;
+        ConcurrentListElementBase* prev = &head_;
+        prev->Lock();
+        ConcurrentListElementBase* current = prev->next_;
+        current->Lock();
+        while (current != &tail_) {
+            if (predicate(*ToTemplateType(current))) {
+                ConcurrentListElementBase* const next = current->next_;
+                next->Lock();
+                prev->next_ = next;
+                next->prev_ = prev;
+                current->prev_ = current->next_ = nullptr;
+                current->Unlock();
+                current = next;
+                ++removed_count;
+            } else {
+                prev->Unlock();
+                prev = current;
+                current = current->next_;
+                current->Lock();
+            }
+        }
+        current->Unlock();
+        prev->Unlock();
+        return removed_count;
+    }
+
+    template <typename T, typename Tag>
+    requires IsConcurrentListElement<T, Tag>
+    bool ConcurrentList<T, Tag>::IsEmpty() noexcept {
+        head_.Lock();
+        const bool is_empty = head_.next_ == &tail_;
+        head_.Unlock();
+        return is_empty;
+    }
+
+    template <typename T, typename Tag>
+    requires IsConcurrentListElement<T, Tag>
+    void ConcurrentList<T, Tag>::LinkBetween(ConcurrentListElementBase* prev, ConcurrentListElementBase* element, ConcurrentListElementBase* next) noexcept {
+        element->prev_ = prev;
+        element->next_ = next;
+        prev->next_ = element;
+        next->prev_ = element;
+    }
+
+    template <typename T, typename Tag>
+    requires IsConcurrentListElement<T, Tag>
+    ConcurrentListElementBase* ConcurrentList<T, Tag>::ToConcurrentListElementBase(T& element) noexcept {
+        return static_cast<ConcurrentListElementBase*>(static_cast<ConcurrentListElement<Tag>*>(&element));
+    }
+
+    template <typename T, typename Tag>
+    requires IsConcurrentListElement<T, Tag>
+    T* ConcurrentList<T, Tag>::ToTemplateType(ConcurrentListElementBase* element) noexcept {
+        return static_cast<T*>(static_cast<ConcurrentListElement<Tag>*>(element));
+    }
+
+} //End of namespace intrusive
+
+#endif //CPP_IMPLEMENTATIONS_CONCURRENT_LIST_H
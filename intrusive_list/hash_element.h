@@ -0,0 +1,84 @@
+#ifndef CPP_IMPLEMENTATIONS_HASH_ELEMENT_H
+#define CPP_IMPLEMENTATIONS_HASH_ELEMENT_H
+
+#include <cstddef>
+#include <type_traits>
+#include "intrusive_list.h"
+
+namespace cpp::intrusive {
+
+    template <typename Tag = DefaultTag>
+    class HashElement;
+
+    template <typename T, typename Tag>
+    concept IsHashElement = std::is_base_of_v<HashElement<Tag>, T>;
+
+    namespace details {
+
+        struct HashElementAccess;
+
+    } // End of namespace cpp::intrusive::details
+
+
+    // Hook of the intrusive hash containers: the link to the next element of the bucket chain and the cached hash.
+    // Unlike ListElement the hook is not unlinked on destruction:
+    // an element must be erased from the container before it is destroyed.
+    class HashElementBase {
+    protected:
+        HashElementBase() = default;
+        ~HashElementBase() = default;
+
+    private:
+        HashElementBase* next_in_bucket_{nullptr};
+        size_t hash_{0};
+
+        friend struct details::HashElementAccess;
+
+    };
+
+    template <typename Tag>
+    class HashElement : private HashElementBase {
+    protected:
+        HashElement() = default;
+        ~HashElement() = default;
+
+    public:
+        HashElement(const HashElement&) = delete;
+        HashElement(const HashElement&&) = delete;
+        HashElement& operator=(const HashElement&) = delete;
+        HashElement& operator=(const HashElement&&) = delete;
+
+        friend struct details::HashElementAccess;
+
+    };
+
+
+    namespace details {
+
+        // The intrusive hash containers reach the hook only through this class,
+        // so the hook does not have to befriend every container.
+        struct HashElementAccess {
+            template <typename Tag, typename T>
+            static HashElementBase* ToHashElementBase(T& element) noexcept {
+                return static_cast<HashElementBase*>(static_cast<HashElement<Tag>*>(&element));
+            }
+
+            template <typename Tag, typename T>
+            static T* ToTemplateType(HashElementBase* hash_element_base) noexcept {
+                return static_cast<T*>(static_cast<HashElement<Tag>*>(hash_element_base));
+            }
+
+            static HashElementBase*& Next(HashElementBase* element) noexcept {
+                return element->next_in_bucket_;
+            }
+
+            static size_t& Hash(HashElementBase* element) noexcept {
+                return element->hash_;
+            }
+        };
+
+    } // End of namespace cpp::intrusive::details
+
+} //End of namespace intrusive
+
+#endif //CPP_IMPLEMENTATIONS_HASH_ELEMENT_H
@@ -0,0 +1,352 @@
+#ifndef CPP_IMPLEMENTATIONS_HASH_TABLE_H
+#define CPP_IMPLEMENTATIONS_HASH_TABLE_H
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <new>
+#include <utility>
+#include "hash_element.h"
+
+namespace cpp::intrusive {
+
+    namespace details {
+
+        struct BucketsDeleter {
+            void operator()(HashElementBase** buckets) const noexcept {
+                std::free(buckets);
+            }
+        };
+
+        // Zeroed with calloc: large arrays come straight from fresh pages,
+        // so allocating a new table does not touch all of its memory at once.
+        class BucketArray {
+        public:
+            BucketArray() = default;
+
+            explicit BucketArray(size_t buckets_count)
+                    : buckets_(static_cast<HashElementBase**>(std::calloc(buckets_count, sizeof(HashElementBase*)))),
+                      mask_(buckets_count - 1) {
+                if (buckets_ == nullptr) {
+                    throw std::bad_alloc();
+                }
+            }
+
+            HashElementBase*& operator[](size_t index) const noexcept {
+                return buckets_[index];
+            }
+
+            HashElementBase*& Bucket(size_t hash) const noexcept {
+                return buckets_[hash & mask_];
+            }
+
+            [[nodiscard]] size_t Index(size_t hash) const noexcept {
+                return hash & mask_;
+            }
+
+            [[nodiscard]] size_t Count() const noexcept {
+                return buckets_ == nullptr ? 0 : mask_ + 1;
+            }
+
+            explicit operator bool() const noexcept {
+                return buckets_ != nullptr;
+            }
+
+        private:
+            std::unique_ptr<HashElementBase*[], BucketsDeleter> buckets_{};
+            size_t mask_{0};
+        };
+
+        struct Identity {
+            template <typename T>
+            const T& operator()(const T& value) const noexcept {
+                return value;
+            }
+        };
+
+    } // End of namespace cpp::intrusive::details
+
+
+    // Intrusive hash table with chained buckets and incremental rehashing.
+    // When the load factor exceeds one, a table of twice the size is allocated and every
+    // following Insert and Erase moves a few buckets of the old table into the new one,
+    // so no single operation pays for rehashing all elements.
+    // Lookups check both tables while the rehashing is in progress.
+    template <typename T, typename Key, typename KeyOf, typename Hash = std::hash<Key>,
+              typename KeyEqual = std::equal_to<Key>, typename Tag = DefaultTag>
+    requires IsHashElement<T, Tag>
+    class HashTable {
+    public:
+        static constexpr size_t kMinBucketsCount = 8;
+        static constexpr size_t kRehashStepBucketsCount = 8;
+
+        explicit HashTable(size_t expected_size = 0, KeyOf key_of = KeyOf(), Hash hash = Hash(), KeyEqual key_equal = KeyEqual());
+
+        HashTable(const HashTable&) = delete;
+        HashTable& operator=(const HashTable&) = delete;
+
+        HashTable(HashTable&&) = delete;
+        HashTable& operator=(HashTable&&) = delete;
+
+        ~HashTable() = default;
+
+        T* Find(const Key& key) const;
+
+        // Returns false and leaves the table unchanged if an element with the same key is already present
+        bool Insert(T& element);
+
+        T* Erase(const Key& key);
+        void Erase(T& element);
+
+        // Grows the table at once, so that the next inserts up to expected_size never rehash
+        void Reserve(size_t expected_size);
+
+        template <typename F>
+        void ForEach(F&& function) const;
+
+        [[nodiscard]] size_t Size() const noexcept;
+        [[nodiscard]] bool IsEmpty() const noexcept;
+        [[nodiscard]] size_t BucketsCount() const noexcept;
+        [[nodiscard]] bool IsRehashing() const noexcept;
+
+    private:
+        using Access = details::HashElementAccess;
+
+        // Returns the link that points to the element with the given key, or to nullptr at the end of the chain
+        HashElementBase** FindLink(const Key& key, size_t hash) const;
+        HashElementBase** FindLinkInChain(HashElementBase** link, const Key& key, size_t hash) const;
+
+        // Returns the link that points to the given element
+        HashElementBase** FindElementLink(HashElementBase* element) const noexcept;
+
+        void StartRehash(size_t buckets_count);
+        void RehashStep(size_t buckets_count);
+        void FinishRehash();
+
+        static void PushToBucket(HashElementBase*& bucket, HashElementBase* element) noexcept;
+
+    private:
+        details::BucketArray buckets_;
+        details::BucketArray old_buckets_{};
+        size_t rehashed_buckets_count_{0};
+        size_t size_{0};
+        [[no_unique_address]] KeyOf key_of_;
+        [[no_unique_address]] Hash hash_;
+        [[no_unique_address]] KeyEqual key_equal_;
+    };
+
+    template <typename T, typename Key, typename KeyOf, typename Hash = std::hash<Key>,
+              typename KeyEqual = std::equal_to<Key>, typename Tag = DefaultTag>
+    using HashMap = HashTable<T, Key, KeyOf, Hash, KeyEqual, Tag>;
+
+    template <typename T, typename Hash = std::hash<T>, typename KeyEqual = std::equal_to<T>, typename Tag = DefaultTag>
+    using HashSet = HashTable<T, T, details::Identity, Hash, KeyEqual, Tag>;
+
+
+    // Implementation
+    template <typename T, typename Key, typename KeyOf, typename Hash, typename KeyEqual, typename Tag>
+    requires IsHashElement<T, Tag>
+    HashTable<T, Key, KeyOf, Hash, KeyEqual, Tag>::HashTable(size_t expected_size, KeyOf key_of, Hash hash, KeyEqual key_equal)
+            : buckets_(std::bit_ceil(std::max(expected_size, kMinBucketsCount))),
+              key_of_(std::move(key_of)),
+              hash_(std::move(hash)),
+              key_equal_(std::move(key_equal)) {}
+
+    template <typename T, typename Key, typename KeyOf, typename Hash, typename KeyEqual, typename Tag>
+    requires IsHashElement<T, Tag>
+    T* HashTable<T, Key, KeyOf, Hash, KeyEqual, Tag>::Find(const Key& key) const {
+        HashElementBase* const element = *FindLink(key, hash_(key));
+        return element == nullptr ? nullptr : Access::ToTemplateType<Tag, T>(element);
+    }
+
+    template <typename T, typename Key, typename KeyOf, typename Hash, typename KeyEqual, typename Tag>
+    requires IsHashElement<T, Tag>
+    bool HashTable<T, Key, KeyOf, Hash, KeyEqual, Tag>::Insert(T& element) {
+        const Key& key = key_of_(element);
+        const size_t hash = hash_(key);
+        if (*FindLink(key, hash) != nullptr) {
+            return false;
+        }
+
+        HashElementBase* const element_as_base = Access::ToHashElementBase<Tag>(element);
+        Access::Hash(element_as_base) = hash;
+        PushToBucket(buckets_.Bucket(hash), element_as_base);
+        ++size_;
+
+        if (IsRehashing()) {
+            RehashStep(kRehashStepBucketsCount);
+        } else if (size_ > buckets_.Count()) {
+            StartRehash(buckets_.Count() * 2);
+        }
+        return true;
+    }
+
+    template <typename T, typename Key, typename KeyOf, typename Hash, typename KeyEqual, typename Tag>
+    requires IsHashElement<T, Tag>
+    T* HashTable<T, Key, KeyOf, Hash, KeyEqual, Tag>::Erase(const Key& key) {
+        HashElementBase** const link = FindLink(key, hash_(key));
+        HashElementBase* const element = *link;
+        if (element == nullptr) {
+            return nullptr;
+        }
+        *link = Access::Next(element);
+        --size_;
+
+        if (IsRehashing()) {
+            RehashStep(kRehashStepBucketsCount);
+        }
+        return Access::ToTemplateType<Tag, T>(element);
+    }
+
+    template <typename T, typename Key, typename KeyOf, typename Hash, typename KeyEqual, typename Tag>
+    requires IsHashElement<T, Tag>
+    void HashTable<T, Key, KeyOf, Hash, KeyEqual, Tag>::Erase(T& element) {
+        HashElementBase* const element_as_base = Access::ToHashElementBase<Tag>(element);
+        HashElementBase** const link = FindElementLink(element_as_base);
+        *link = Access::Next(element_as_base);
+        --size_;
+
+        if (IsRehashing()) {
+            RehashStep(kRehashStepBucketsCount);
+        }
+    }
+
+    template <typename T, typename Key, typename KeyOf, typename Hash, typename KeyEqual, typename Tag>
+    requires IsHashElement<T, Tag>
+    void HashTable<T, Key, KeyOf, Hash, KeyEqual, Tag>::Reserve(size_t expected_size) {
+        FinishRehash();
+        if (expected_size > buckets_.Count()) {
+            StartRehash(std::bit_ceil(expected_size));
+            FinishRehash();
+        }
+    }
+
+    template <typename T, typename Key, typename KeyOf, typename Hash, typename KeyEqual, typename Tag>
+    requires IsHashElement<T, Tag>
+    template <typename F>
+    void HashTable<T, Key, KeyOf, Hash, KeyEqual, Tag>::ForEach(F&& function) const {
+        auto traverse = [&function](const details::BucketArray& buckets, size_t first_bucket) {
+            for (size_t i = first_bucket; i < buckets.Count(); i++) {
+                for (HashElementBase* element = buckets[i]; element != nullptr;) {
+                    HashElementBase* const next = Access::Next(element);
+                    function(*Access::ToTemplateType<Tag, T>(element));
+                    element = next;
+                }
+            }
+        };
+        traverse(buckets_, 0);
+        if (IsRehashing()) {
+            traverse(old_buckets_, rehashed_buckets_count_);
+        }
+    }
+
+    template <typename T, typename Key, typename KeyOf, typename Hash, typename KeyEqual, typename Tag>
+    requires IsHashElement<T, Tag>
+    size_t HashTable<T, Key, KeyOf, Hash, KeyEqual, Tag>::Size() const noexcept {
+        return size_;
+    }
+
+    template <typename T, typename Key, typename KeyOf, typename Hash, typename KeyEqual, typename Tag>
+    requires IsHashElement<T, Tag>
+    bool HashTable<T, Key, KeyOf, Hash, KeyEqual, Tag>::IsEmpty() const noexcept {
+        return size_ == 0;
+    }
+
+    template <typename T, typename Key, typename KeyOf, typename Hash, typename KeyEqual, typename Tag>
+    requires IsHashElement<T, Tag>
+    size_t HashTable<T, Key, KeyOf, Hash, KeyEqual, Tag>::BucketsCount() const noexcept {
+        return buckets_.Count();
+    }
+
+    template <typename T, typename Key, typename KeyOf, typename Hash, typename KeyEqual, typename Tag>
+    requires IsHashElement<T, Tag>
+    bool HashTable<T, Key, KeyOf, Hash, KeyEqual, Tag>::IsRehashing() const noexcept {
+        return static_cast<bool>(old_buckets_);
+    }
+
+    template <typename T, typename Key, typename KeyOf, typename Hash, typename KeyEqual, typename Tag>
+    requires IsHashElement<T, Tag>
+    HashElementBase** HashTable<T, Key, KeyOf, Hash, KeyEqual, Tag>::FindLink(const Key& key, size_t hash) const {
+        HashElementBase** link = FindLinkInChain(&buckets_.Bucket(hash), key, hash);
+        if (*link == nullptr && IsRehashing() && old_buckets_.Index(hash) >= rehashed_buckets_count_) {
+            HashElementBase** const old_link = FindLinkInChain(&old_buckets_.Bucket(hash), key, hash);
+            if (*old_link != nullptr) {
+                return old_link;
+            }
+        }
+        return link;
+    }
+
+    template <typename T, typename Key, typename KeyOf, typename Hash, typename KeyEqual, typename Tag>
+    requires IsHashElement<T, Tag>
+    HashElementBase** HashTable<T, Key, KeyOf, Hash, KeyEqual, Tag>::FindLinkInChain(HashElementBase** link, const Key& key, size_t hash) const {
+        while (*link != nullptr && (Access::Hash(*link) != hash || !key_equal_(key_of_(*Access::ToTemplateType<Tag, T>(*link)), key))) {
+            link = &Access::Next(*link);
+        }
+        return link;
+    }
+
+    template <typename T, typename Key, typename KeyOf, typename Hash, typename KeyEqual, typename Tag>
+    requires IsHashElement<T, Tag>
+    HashElementBase** HashTable<T, Key, KeyOf, Hash, KeyEqual, Tag>::FindElementLink(HashElementBase* element) const noexcept {
+        const size_t hash = Access::Hash(element);
+        if (IsRehashing() && old_buckets_.Index(hash) >= rehashed_buckets_count_) {
+            for (HashElementBase** link = &old_buckets_.Bucket(hash); *link != nullptr; link = &Access::Next(*link)) {
+                if (*link == element) {
+                    return link;
+                }
+            }
+        }
+        HashElementBase** link = &buckets_.Bucket(hash);
+        while (*link != element) {
+            link = &Access::Next(*link);
+        }
+        return link;
+    }
+
+    template <typename T, typename Key, typename KeyOf, typename Hash, typename KeyEqual, typename Tag>
+    requires IsHashElement<T, Tag>
+    void HashTable<T, Key, KeyOf, Hash, KeyEqual, Tag>::StartRehash(size_t buckets_count) {
+        old_buckets_ = std::exchange(buckets_, details::BucketArray(buckets_count));
+        rehashed_buckets_count_ = 0;
+        RehashStep(kRehashStepBucketsCount);
+    }
+
+    template <typename T, typename Key, typename KeyOf, typename Hash, typename KeyEqual, typename Tag>
+    requires IsHashElement<T, Tag>
+    void HashTable<T, Key, KeyOf, Hash, KeyEqual, Tag>::RehashStep(size_t buckets_count) {
+        const size_t last_bucket = std::min(rehashed_buckets_count_ + buckets_count, old_buckets_.Count());
+        for (; rehashed_buckets_count_ < last_bucket; rehashed_buckets_count_++) {
+            HashElementBase* element = std::exchange(old_buckets_[rehashed_buckets_count_], nullptr);
+            while (element != nullptr) {
+                HashElementBase* const next = Access::Next(element);
+                PushToBucket(buckets_.Bucket(Access::Hash(element)), element);
+                element = next;
+            }
+        }
+        if (rehashed_buckets_count_ == old_buckets_.Count()) {
+            old_buckets_ = details::BucketArray();
+        }
+    }
+
+    template <typename T, typename Key, typename KeyOf, typename Hash, typename KeyEqual, typename Tag>
+    requires IsHashElement<T, Tag>
+    void HashTable<T, Key, KeyOf, Hash, KeyEqual, Tag>::FinishRehash() {
+        if (IsRehashing()) {
+            RehashStep(old_buckets_.Count());
+        }
+    }
+
+    template <typename T, typename Key, typename KeyOf, typename Hash, typename KeyEqual, typename Tag>
+    requires IsHashElement<T, Tag>
+    void HashTable<T, Key, KeyOf, Hash, KeyEqual, Tag>::PushToBucket(HashElementBase*& bucket, HashElementBase* element) noexcept {
+        Access::Next(element) = bucket;
+        bucket = element;
+    }
+
+} //End of namespace intrusive
+
+#endif //CPP_IMPLEMENTATIONS_HASH_TABLE_H
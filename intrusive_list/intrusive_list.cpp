@@ -2,8 +2,6 @@
 
 namespace cpp::intrusive {
 
-    ListElementBase::ListElementBase() : prev_(this), next_(this) {}
-
     void ListElementBase::InsertBetween(ListElementBase* left, ListElementBase* right) {
         prev_ = left;
         next_ = right;
@@ -25,8 +23,17 @@ namespace cpp::intrusive {
         prev_ = next_ = this;
     }
 
-    ListElementBase::~ListElementBase() {
-        Unlink();
+    void ListElementBase::TransferRange(ListElementBase* position, ListElementBase* first, ListElementBase* last) {
+        ListElementBase* const last_in_range = last->prev_;
+
+        first->prev_->next_ = last;
+        last->prev_ = first->prev_;
+
+        ListElementBase* const before_position = position->prev_;
+        before_position->next_ = first;
+        first->prev_ = before_position;
+        last_in_range->next_ = position;
+        position->prev_ = last_in_range;
     }
 
 } //End of namespace intrusive
@@ -1,6 +1,10 @@
 #ifndef CPP_IMPLEMENTATIONS_INTRUSIVE_LIST_H
 #define CPP_IMPLEMENTATIONS_INTRUSIVE_LIST_H
 
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <iterator>
 #include <type_traits>
 #include <ostream>
 
@@ -8,43 +12,77 @@ namespace cpp::intrusive {
 
     class DefaultTag;
 
-    template <typename Tag = DefaultTag>
+    // What the hook does when the element is destroyed:
+    // kAutoUnlink unlinks the element from its list, kSafe asserts that the element is not linked,
+    // kNormal does nothing, so the element must be removed from the list before it is destroyed.
+    // kSafe also asserts that an element is not inserted into a list twice.
+    enum class LinkMode {
+        kNormal,
+        kSafe,
+        kAutoUnlink
+    };
+
+    template <typename Tag = DefaultTag, LinkMode Mode = LinkMode::kAutoUnlink>
     class ListElement;
 
+    namespace details {
+
+        template <typename Tag, LinkMode Mode>
+        std::integral_constant<LinkMode, Mode> ListElementLinkMode(const ListElement<Tag, Mode>*);
+
+    } // End of namespace cpp::intrusive::details
+
+    template <typename T, typename Tag>
+    concept IsListElement = requires(const T* element) {
+        details::ListElementLinkMode<Tag>(element);
+    };
+
     template <typename T, typename Tag>
-    concept IsListElement = std::is_base_of_v<ListElement<Tag>, T>;
+    requires IsListElement<T, Tag>
+    inline constexpr LinkMode kListElementLinkMode = decltype(details::ListElementLinkMode<Tag>(std::declval<const T*>()))::value;
 
-    template <typename T, typename Tag = DefaultTag>
+    template <typename T, typename Tag = DefaultTag, bool ConstantTimeSize = false>
     requires IsListElement<T, Tag>
     class List;
 
 
     class ListElementBase {
     protected:
-        ListElementBase();
-        ~ListElementBase();
+        ListElementBase() = default;
+        ~ListElementBase() = default;
+
+        [[nodiscard]] bool IsLinked() const noexcept {
+            return next_ != this;
+        }
+
+        void Unlink();
 
     private:
         void InsertBetween(ListElementBase* left, ListElementBase* right);
         void InsertBefore(ListElementBase& element);
         void InsertAfter(ListElementBase& element);
-        void Unlink();
+
+        // Relinks the range [first, last) before position. The range may belong to another list.
+        static void TransferRange(ListElementBase* position, ListElementBase* first, ListElementBase* last);
 
     private:
         ListElementBase* prev_{this};
         ListElementBase* next_{this};
 
-        template <typename T, typename Tag>
+        template <typename T, typename Tag, bool ConstantTimeSize>
         requires IsListElement<T, Tag>
         friend class List;
 
     };
 
-    template <typename Tag>
+    template <typename Tag, LinkMode Mode>
     class ListElement: private ListElementBase {
     protected:
         ListElement() = default;
-        ~ListElement() = default;
+        ~ListElement();
+
+        // Removes the element from its list. The list must not have ConstantTimeSize.
+        using ListElementBase::Unlink;
 
     public:
         ListElement(const ListElement&) = delete;
@@ -52,21 +90,62 @@ namespace cpp::intrusive {
         ListElement& operator=(const ListElement&) = delete;
         ListElement& operator=(const ListElement&&) = delete;
 
-        template <typename T, typename Tag_>
+        using ListElementBase::IsLinked;
+
+        template <typename T, typename Tag_, bool ConstantTimeSize>
         requires IsListElement<T, Tag_>
         friend class List;
 
     };
 
 
-    template <typename T, typename Tag>
+    namespace details {
+
+        template <bool ConstantTimeSize>
+        struct ListSize {
+            void Increase(size_t) noexcept {}
+            void Decrease(size_t) noexcept {}
+        };
+
+        template <>
+        struct ListSize<true> {
+            void Increase(size_t count) noexcept {
+                value += count;
+            }
+
+            void Decrease(size_t count) noexcept {
+                value -= count;
+            }
+
+            size_t value{0};
+        };
+
+        inline void Prefetch([[maybe_unused]] const void* address) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+            __builtin_prefetch(address);
+#endif
+        }
+
+        struct NoPrefetchField {};
+
+    } // End of namespace cpp::intrusive::details
+
+
+    // With ConstantTimeSize the list stores its size. In this mode elements must be removed
+    // through the list before they are destroyed or inserted into another list.
+    template <typename T, typename Tag, bool ConstantTimeSize>
     requires IsListElement<T, Tag>
     class List {
     private:
         template <bool isConstType>
         class Iterator;
 
+        class PrefetchIterator;
+        class PrefetchRange;
+
     public:
+        static constexpr size_t kDefaultPrefetchDistance = 4;
+
         using iterator = Iterator<false>;
         using const_iterator = Iterator<true>;
         using reverse_iterator = std::reverse_iterator<iterator>;
@@ -84,9 +163,14 @@ namespace cpp::intrusive {
 
         void Swap(List& other) noexcept;
 
+        [[nodiscard]] bool IsEmpty() const noexcept;
+        [[nodiscard]] size_t Size() const noexcept;
+
         T* Front() const noexcept;
         T* Back() const noexcept;
 
+        // Inserts the element before position. Without ConstantTimeSize a linked element is first unlinked
+        // from its list. With ConstantTimeSize the element must be unlinked, as the size of its list can not be updated.
         iterator Insert(const_iterator position, T& element);
 
         iterator Erase(const_iterator position);
@@ -96,6 +180,30 @@ namespace cpp::intrusive {
         void PopBack();
         void PopFront();
 
+        // Moves all elements of other before position
+        void Splice(const_iterator position, List& other);
+
+        // Moves the elements [first, last) of other before position.
+        // It is O(1) without ConstantTimeSize, otherwise the range is counted.
+        void Splice(const_iterator position, List& other, const_iterator first, const_iterator last);
+
+        // The same as above, but the caller provides the size of the range, so it is always O(1)
+        void Splice(const_iterator position, List& other, const_iterator first, const_iterator last, size_t count);
+
+        // Stable bottom-up merge sort. Only relinks the elements, never allocates.
+        template <typename Compare = std::less<>>
+        void Sort(Compare compare = Compare());
+
+        // Moves all elements of the sorted other into this sorted list, keeping it sorted.
+        // Equal elements of this list stay before the elements of other.
+        template <typename Compare = std::less<>>
+        void Merge(List& other, Compare compare = Compare());
+
+        // Inserts the element after all elements that are not greater than it. The search starts from the back,
+        // so inserting in almost ascending order is O(1).
+        template <typename Compare = std::less<>>
+        iterator InsertSorted(T& element, Compare compare = Compare());
+
         iterator begin();
         iterator end();
         const_iterator cbegin();
@@ -106,12 +214,27 @@ namespace cpp::intrusive {
         const_reverse_iterator crbegin();
         const_reverse_iterator crend();
 
+        iterator GetIterator(T& element);
+        const_iterator GetIterator(T& element) const;
+
+        // Calls function(T&) for every element and prefetches the element distance nodes ahead,
+        // so the work on the current element overlaps with the loads of the next ones.
+        // field(const T&) may return the address of a field, e.g. an out-of-line payload, to prefetch as well.
+        // The function may erase the element it is called with, but no other elements.
+        template <typename F, typename Field = details::NoPrefetchField>
+        void ForEachPrefetch(F&& function, size_t distance = kDefaultPrefetchDistance, Field field = Field());
+
+        // Range for the range-based for loop that prefetches the element distance nodes ahead of the current one
+        PrefetchRange Prefetching(size_t distance = kDefaultPrefetchDistance);
+
         friend std::ostream &operator<<(std::ostream& os, const List& list) {
-            static auto print_list_element = [&os, &list](ListElementBase* current_element) {
-                os << *ToTemplateType(current_element);
-                if (current_element->next_ != &list.empty_element_) {
+            bool is_first_element = true;
+            auto print_list_element = [&os, &is_first_element](ListElementBase* current_element) {
+                if (!is_first_element) {
                     os << ", ";
                 }
+                is_first_element = false;
+                os << *ToTemplateType(current_element);
             };
 
             os << "List=[";
@@ -127,6 +250,19 @@ namespace cpp::intrusive {
         static ListElementBase* ToListElementBase(T& element);
         static T* ToTemplateType(ListElementBase* list_element_base);
 
+        // Unlinks all elements and returns them as a chain linked through next_ and terminated by nullptr
+        ListElementBase* DetachChain() noexcept;
+
+        // Links the chain into the empty list and restores the prev_ links
+        void AttachChain(ListElementBase* chain) noexcept;
+
+        template <typename Compare>
+        static ListElementBase* MergeChains(ListElementBase* left, ListElementBase* right, Compare& compare);
+
+        static void AssertNotLinked(ListElementBase* element);
+
+        using Element = ListElement<Tag, kListElementLinkMode<T, Tag>>;
+
         template <bool isConstType>
         class Iterator {
         public:
@@ -159,255 +295,595 @@ namespace cpp::intrusive {
             ListElementBase* current_element_;
         };
 
+        class PrefetchIterator {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = T*;
+            using reference = T&;
+
+            PrefetchIterator(ListElementBase* element, ListElementBase* ahead_element, const ListElementBase* end);
+
+            PrefetchIterator& operator++();
+
+            bool operator==(const PrefetchIterator& other) const noexcept;
+            bool operator!=(const PrefetchIterator& other) const noexcept;
+
+            reference operator*() const;
+            pointer operator->() const;
+
+        private:
+            ListElementBase* current_element_;
+            ListElementBase* ahead_element_;
+            const ListElementBase* end_;
+        };
+
+        class PrefetchRange {
+        public:
+            PrefetchRange(List& list, size_t distance);
+
+            PrefetchIterator begin() const;
+            PrefetchIterator end() const;
+
+        private:
+            List& list_;
+            size_t distance_;
+        };
+
     private:
         ListElementBase empty_element_{};
+        [[no_unique_address]] details::ListSize<ConstantTimeSize> size_{};
     };
 
-    template <typename T, typename Tag>
-    void swap(List<T, Tag>& first, List<T, Tag>& second);
+    template <typename T, typename Tag, bool ConstantTimeSize>
+    void swap(List<T, Tag, ConstantTimeSize>& first, List<T, Tag, ConstantTimeSize>& second);
 
 
     // Implementation
-    template <typename T, typename Tag>
+    template <typename Tag, LinkMode Mode>
+    ListElement<Tag, Mode>::~ListElement() {
+        if constexpr (Mode == LinkMode::kAutoUnlink) {
+            if (IsLinked()) {
+                Unlink();
+            }
+        } else if constexpr (Mode == LinkMode::kSafe) {
+            assert(!IsLinked() && "The element is destroyed while it is linked");
+        }
+    }
+
+    template <typename T, typename Tag, bool ConstantTimeSize>
     requires IsListElement<T, Tag>
-    List<T, Tag>::List(List&& other) noexcept {
-        swap(other);
+    List<T, Tag, ConstantTimeSize>::List(List&& other) noexcept {
+        Swap(other);
     }
 
-    template <typename T, typename Tag>
+    template <typename T, typename Tag, bool ConstantTimeSize>
     requires IsListElement<T, Tag>
-    List<T, Tag>& List<T, Tag>::operator=(List&& other) noexcept {
-        swap(other);
+    List<T, Tag, ConstantTimeSize>& List<T, Tag, ConstantTimeSize>::operator=(List&& other) noexcept {
+        Swap(other);
+        return *this;
     }
 
-    template <typename T, typename Tag>
+    template <typename T, typename Tag, bool ConstantTimeSize>
     requires IsListElement<T, Tag>
-    List<T, Tag>::~List() {
-        ListElementBase* current_element = &empty_element_;
-        do {
-            ListElementBase* const next_element = current_element->next_;
-            current_element->Unlink();
-            current_element = next_element;
-        } while (current_element != &empty_element_);
+    List<T, Tag, ConstantTimeSize>::~List() {
+        while (!IsEmpty()) {
+            empty_element_.next_->Unlink();
+        }
     }
 
-    template <typename T, typename Tag>
+    template <typename T, typename Tag, bool ConstantTimeSize>
     requires IsListElement<T, Tag>
-    void List<T, Tag>::Swap(List& other) noexcept {
+    void List<T, Tag, ConstantTimeSize>::Swap(List& other) noexcept {
         using std::swap;
-        swap(empty_element_.next_->prev_, other.empty_element_.next_->prev_);
-        swap(empty_element_.prev_->next_, other.empty_element_.prev_->next_);
         swap(empty_element_.next_, other.empty_element_.next_);
         swap(empty_element_.prev_, other.empty_element_.prev_);
+        swap(size_, other.size_);
+
+        auto relink_sentinel = [](ListElementBase& empty_element, ListElementBase& other_empty_element) {
+            if (empty_element.next_ == &other_empty_element) {
+                empty_element.next_ = empty_element.prev_ = &empty_element;
+            } else {
+                empty_element.next_->prev_ = &empty_element;
+                empty_element.prev_->next_ = &empty_element;
+            }
+        };
+        relink_sentinel(empty_element_, other.empty_element_);
+        relink_sentinel(other.empty_element_, empty_element_);
     }
 
+    template <typename T, typename Tag, bool ConstantTimeSize>
+    requires IsListElement<T, Tag>
+    bool List<T, Tag, ConstantTimeSize>::IsEmpty() const noexcept {
+        return empty_element_.next_ == &empty_element_;
+    }
 
-    template <typename T, typename Tag>
+    template <typename T, typename Tag, bool ConstantTimeSize>
     requires IsListElement<T, Tag>
-    T* List<T, Tag>::Front() const noexcept {
+    size_t List<T, Tag, ConstantTimeSize>::Size() const noexcept {
+        if constexpr (ConstantTimeSize) {
+            return size_.value;
+        } else {
+            size_t size = 0;
+            TraverseListAndInvoke([&size](ListElementBase*) { ++size; });
+            return size;
+        }
+    }
+
+
+    template <typename T, typename Tag, bool ConstantTimeSize>
+    requires IsListElement<T, Tag>
+    T* List<T, Tag, ConstantTimeSize>::Front() const noexcept {
         return ToTemplateType(empty_element_.next_);
     }
 
-    template <typename T, typename Tag>
+    template <typename T, typename Tag, bool ConstantTimeSize>
     requires IsListElement<T, Tag>
-    T* List<T, Tag>::Back() const noexcept {
+    T* List<T, Tag, ConstantTimeSize>::Back() const noexcept {
         return ToTemplateType(empty_element_.prev_);
     }
 
-    template<typename T, typename Tag>
+    template <typename T, typename Tag, bool ConstantTimeSize>
     requires IsListElement<T, Tag>
-    List<T, Tag>::iterator List<T, Tag>::Insert(List::const_iterator position, T& element) {
+    List<T, Tag, ConstantTimeSize>::iterator List<T, Tag, ConstantTimeSize>::Insert(List::const_iterator position, T& element) {
         auto position_as_base = position.current_element_;
         auto element_as_base = ToListElementBase(element);
-        element_as_base->Unlink();
+        AssertNotLinked(element_as_base);
+        if constexpr (ConstantTimeSize) {
+            assert(!element_as_base->IsLinked() && "The element must be erased from its list before it is inserted");
+        } else {
+            element_as_base->Unlink();
+        }
         element_as_base->InsertBefore(*position_as_base);
+        size_.Increase(1);
         return iterator(element_as_base);
     }
 
-    template <typename T, typename Tag>
+    template <typename T, typename Tag, bool ConstantTimeSize>
     requires IsListElement<T, Tag>
-    void List<T, Tag>::PushBack(T &element) {
+    void List<T, Tag, ConstantTimeSize>::PushBack(T &element) {
         auto element_as_base = ToListElementBase(element);
+        AssertNotLinked(element_as_base);
         element_as_base->InsertBefore(empty_element_);
+        size_.Increase(1);
     }
 
-    template <typename T, typename Tag>
+    template <typename T, typename Tag, bool ConstantTimeSize>
     requires IsListElement<T, Tag>
-    void List<T, Tag>::PushFront(T &element) {
+    void List<T, Tag, ConstantTimeSize>::PushFront(T &element) {
         auto element_as_base = ToListElementBase(element);
+        AssertNotLinked(element_as_base);
         element_as_base->InsertAfter(empty_element_);
+        size_.Increase(1);
     }
 
-    template <typename T, typename Tag>
+    template <typename T, typename Tag, bool ConstantTimeSize>
     requires IsListElement<T, Tag>
-    void List<T, Tag>::PopBack() {
+    void List<T, Tag, ConstantTimeSize>::PopBack() {
         empty_element_.prev_->Unlink();
+        size_.Decrease(1);
     }
 
-    template <typename T, typename Tag>
+    template <typename T, typename Tag, bool ConstantTimeSize>
     requires IsListElement<T, Tag>
-    void List<T, Tag>::PopFront() {
+    void List<T, Tag, ConstantTimeSize>::PopFront() {
         empty_element_.next_->Unlink();
+        size_.Decrease(1);
     }
 
-    template <typename T, typename Tag>
+    template <typename T, typename Tag, bool ConstantTimeSize>
     requires IsListElement<T, Tag>
-    List<T, Tag>::iterator List<T, Tag>::Erase(List::const_iterator position) {
+    List<T, Tag, ConstantTimeSize>::iterator List<T, Tag, ConstantTimeSize>::Erase(List::const_iterator position) {
         iterator result = iterator(position.current_element_->next_);
         position.current_element_->Unlink();
+        size_.Decrease(1);
         return result;
     }
 
-    template <typename T, typename Tag>
+    template <typename T, typename Tag, bool ConstantTimeSize>
+    requires IsListElement<T, Tag>
+    void List<T, Tag, ConstantTimeSize>::Splice(const_iterator position, List& other) {
+        if (this == &other || other.IsEmpty()) {
+            return;
+        }
+        ListElementBase::TransferRange(position.current_element_, other.empty_element_.next_, &other.empty_element_);
+        if constexpr (ConstantTimeSize) {
+            size_.Increase(other.size_.value);
+            other.size_.value = 0;
+        }
+    }
+
+    template <typename T, typename Tag, bool ConstantTimeSize>
+    requires IsListElement<T, Tag>
+    void List<T, Tag, ConstantTimeSize>::Splice(const_iterator position, List& other, const_iterator first, const_iterator last) {
+        if constexpr (ConstantTimeSize) {
+            Splice(position, other, first, last, this == &other ? 0 : static_cast<size_t>(std::distance(first, last)));
+        } else {
+            Splice(position, other, first, last, 0);
+        }
+    }
+
+    template <typename T, typename Tag, bool ConstantTimeSize>
+    requires IsListElement<T, Tag>
+    void List<T, Tag, ConstantTimeSize>::Splice(const_iterator position, List& other, const_iterator first, const_iterator last, size_t count) {
+        if (first == last || position == first || position == last) {
+            return;
+        }
+        ListElementBase::TransferRange(position.current_element_, first.current_element_, last.current_element_);
+        if (this != &other) {
+            size_.Increase(count);
+            other.size_.Decrease(count);
+        }
+    }
+
+    template <typename T, typename Tag, bool ConstantTimeSize>
+    requires IsListElement<T, Tag>
+    template <typename Compare>
+    void List<T, Tag, ConstantTimeSize>::Sort(Compare compare) {
+        // bins[i] is a sorted chain of 2^i elements, the higher bins hold the earlier elements
+        constexpr size_t kBinsCount = 64;
+        ListElementBase* bins[kBinsCount] = {};
+
+        ListElementBase* chain = DetachChain();
+        while (chain != nullptr) {
+            ListElementBase* carry = chain;
+            chain = chain->next_;
+            carry->next_ = nullptr;
+
+            size_t bin = 0;
+            for (; bins[bin] != nullptr; bin++) {
+                carry = MergeChains(bins[bin], carry, compare);
+                bins[bin] = nullptr;
+            }
+            bins[bin] = carry;
+        }
+
+        ListElementBase* sorted = nullptr;
+        for (ListElementBase* bin : bins) {
+            if (bin != nullptr) {
+                sorted = MergeChains(bin, sorted, compare);
+            }
+        }
+        AttachChain(sorted);
+    }
+
+    template <typename T, typename Tag, bool ConstantTimeSize>
+    requires IsListElement<T, Tag>
+    template <typename Compare>
+    void List<T, Tag, ConstantTimeSize>::Merge(List& other, Compare compare) {
+        if (this == &other || other.IsEmpty()) {
+            return;
+        }
+        AttachChain(MergeChains(DetachChain(), other.DetachChain(), compare));
+        if constexpr (ConstantTimeSize) {
+            size_.Increase(other.size_.value);
+            other.size_.value = 0;
+        }
+    }
+
+    template <typename T, typename Tag, bool ConstantTimeSize>
+    requires IsListElement<T, Tag>
+    template <typename Compare>
+    List<T, Tag, ConstantTimeSize>::iterator List<T, Tag, ConstantTimeSize>::InsertSorted(T& element, Compare compare) {
+        ListElementBase* position = &empty_element_;
+        while (position->prev_ != &empty_element_ && compare(element, *ToTemplateType(position->prev_))) {
+            position = position->prev_;
+        }
+        return Insert(const_iterator(position), element);
+    }
+
+    template <typename T, typename Tag, bool ConstantTimeSize>
+    requires IsListElement<T, Tag>
+    template <typename F, typename Field>
+    void List<T, Tag, ConstantTimeSize>::ForEachPrefetch(F&& function, size_t distance, Field field) {
+        ListElementBase* ahead = empty_element_.next_;
+        for (size_t i = 0; i < distance && ahead != &empty_element_; i++) {
+            ahead = ahead->next_;
+            details::Prefetch(ahead);
+        }
+
+        for (ListElementBase* current = empty_element_.next_; current != &empty_element_;) {
+            ListElementBase* const next = current->next_;
+            if (ahead != &empty_element_) {
+                // The ahead element was prefetched on the previous step, so its fields are likely loaded by now
+                if constexpr (!std::is_same_v<Field, details::NoPrefetchField>) {
+                    details::Prefetch(field(*ToTemplateType(ahead)));
+                }
+                ahead = ahead->next_;
+                details::Prefetch(ahead);
+            }
+            function(*ToTemplateType(current));
+            current = next;
+        }
+    }
+
+    template <typename T, typename Tag, bool ConstantTimeSize>
+    requires IsListElement<T, Tag>
+    List<T, Tag, ConstantTimeSize>::PrefetchRange List<T, Tag, ConstantTimeSize>::Prefetching(size_t distance) {
+        return PrefetchRange(*this, distance);
+    }
+
+    template <typename T, typename Tag, bool ConstantTimeSize>
+    requires IsListElement<T, Tag>
+    ListElementBase* List<T, Tag, ConstantTimeSize>::DetachChain() noexcept {
+        if (IsEmpty()) {
+            return nullptr;
+        }
+        ListElementBase* const chain = empty_element_.next_;
+        empty_element_.prev_->next_ = nullptr;
+        empty_element_.next_ = empty_element_.prev_ = &empty_element_;
+        return chain;
+    }
+
+    template <typename T, typename Tag, bool ConstantTimeSize>
+    requires IsListElement<T, Tag>
+    void List<T, Tag, ConstantTimeSize>::AttachChain(ListElementBase* chain) noexcept {
+        ListElementBase* prev = &empty_element_;
+        for (; chain != nullptr; chain = chain->next_) {
+            chain->prev_ = prev;
+            prev->next_ = chain;
+            prev = chain;
+        }
+        prev->next_ = &empty_element_;
+        empty_element_.prev_ = prev;
+    }
+
+    template <typename T, typename Tag, bool ConstantTimeSize>
+    requires IsListElement<T, Tag>
+    template <typename Compare>
+    ListElementBase* List<T, Tag, ConstantTimeSize>::MergeChains(ListElementBase* left, ListElementBase* right, Compare& compare) {
+        ListElementBase* result = nullptr;
+        ListElementBase** link = &result;
+        while (left != nullptr && right != nullptr) {
+            if (compare(*ToTemplateType(right), *ToTemplateType(left))) {
+                *link = right;
+                right = right->next_;
+            } else {
+                *link = left;
+                left = left->next_;
+            }
+            link = &(*link)->next_;
+        }
+        *link = left != nullptr ? left : right;
+        return result;
+    }
+
+    template <typename T, typename Tag, bool ConstantTimeSize>
     requires IsListElement<T, Tag>
     template <typename F>
-    void List<T, Tag>::TraverseListAndInvoke(F&& function) const {
+    void List<T, Tag, ConstantTimeSize>::TraverseListAndInvoke(F&& function) const {
         for (auto cur = empty_element_.next_; cur != &empty_element_; cur = cur->next_) {
             function(cur);
         }
     }
 
-    template <typename T, typename Tag>
+    template <typename T, typename Tag, bool ConstantTimeSize>
     requires IsListElement<T, Tag>
-    ListElementBase* List<T, Tag>::ToListElementBase(T& element) {
-        return static_cast<ListElementBase*>(&element);
+    ListElementBase* List<T, Tag, ConstantTimeSize>::ToListElementBase(T& element) {
+        return static_cast<ListElementBase*>(static_cast<Element*>(&element));
     }
 
-    template <typename T, typename Tag>
+    template <typename T, typename Tag, bool ConstantTimeSize>
     requires IsListElement<T, Tag>
-    T* List<T, Tag>::ToTemplateType(ListElementBase* list_element_base) {
-        return static_cast<T*>(list_element_base);
+    T* List<T, Tag, ConstantTimeSize>::ToTemplateType(ListElementBase* list_element_base) {
+        return static_cast<T*>(static_cast<Element*>(list_element_base));
+    }
+
+    template <typename T, typename Tag, bool ConstantTimeSize>
+    requires IsListElement<T, Tag>
+    void List<T, Tag, ConstantTimeSize>::AssertNotLinked([[maybe_unused]] ListElementBase* element) {
+        if constexpr (kListElementLinkMode<T, Tag> == LinkMode::kSafe) {
+            assert(!element->IsLinked() && "The element is already linked into a list");
+        }
     }
 
 
     // Iterators
-    template <typename T, typename Tag>
+    template <typename T, typename Tag, bool ConstantTimeSize>
     requires IsListElement<T, Tag>
-    List<T, Tag>::iterator List<T, Tag>::begin() {
+    List<T, Tag, ConstantTimeSize>::iterator List<T, Tag, ConstantTimeSize>::begin() {
         return iterator(empty_element_.next_);
     }
 
-    template <typename T, typename Tag>
+    template <typename T, typename Tag, bool ConstantTimeSize>
     requires IsListElement<T, Tag>
-    List<T, Tag>::iterator List<T, Tag>::end() {
+    List<T, Tag, ConstantTimeSize>::iterator List<T, Tag, ConstantTimeSize>::end() {
         return iterator(&empty_element_);
     }
 
-    template <typename T, typename Tag>
+    template <typename T, typename Tag, bool ConstantTimeSize>
     requires IsListElement<T, Tag>
-    List<T, Tag>::const_iterator List<T, Tag>::cbegin() {
+    List<T, Tag, ConstantTimeSize>::const_iterator List<T, Tag, ConstantTimeSize>::cbegin() {
         return const_iterator(empty_element_.next_);
     }
 
-    template <typename T, typename Tag>
+    template <typename T, typename Tag, bool ConstantTimeSize>
     requires IsListElement<T, Tag>
-    List<T, Tag>::const_iterator List<T, Tag>::cend() {
+    List<T, Tag, ConstantTimeSize>::const_iterator List<T, Tag, ConstantTimeSize>::cend() {
         return const_iterator(&empty_element_);
     }
 
     // Reverse iterators
-    template <typename T, typename Tag>
+    template <typename T, typename Tag, bool ConstantTimeSize>
     requires IsListElement<T, Tag>
-    List<T, Tag>::reverse_iterator List<T, Tag>::rbegin() {
-        return reverse_iterator(empty_element_.prev_);
+    List<T, Tag, ConstantTimeSize>::reverse_iterator List<T, Tag, ConstantTimeSize>::rbegin() {
+        return reverse_iterator(end());
     }
 
-    template <typename T, typename Tag>
+    template <typename T, typename Tag, bool ConstantTimeSize>
     requires IsListElement<T, Tag>
-    List<T, Tag>::reverse_iterator List<T, Tag>::rend() {
-        return reverse_iterator(&empty_element_);
+    List<T, Tag, ConstantTimeSize>::reverse_iterator List<T, Tag, ConstantTimeSize>::rend() {
+        return reverse_iterator(begin());
     }
 
-    template <typename T, typename Tag>
+    template <typename T, typename Tag, bool ConstantTimeSize>
     requires IsListElement<T, Tag>
-    List<T, Tag>::const_reverse_iterator List<T, Tag>::crbegin() {
-        return const_reverse_iterator(empty_element_.prev_);
+    List<T, Tag, ConstantTimeSize>::const_reverse_iterator List<T, Tag, ConstantTimeSize>::crbegin() {
+        return const_reverse_iterator(cend());
     }
 
-    template <typename T, typename Tag>
+    template <typename T, typename Tag, bool ConstantTimeSize>
     requires IsListElement<T, Tag>
-    List<T, Tag>::const_reverse_iterator List<T, Tag>::crend() {
-        return const_reverse_iterator(&empty_element_);
+    List<T, Tag, ConstantTimeSize>::const_reverse_iterator List<T, Tag, ConstantTimeSize>::crend() {
+        return const_reverse_iterator(cbegin());
+    }
+
+    template <typename T, typename Tag, bool ConstantTimeSize>
+    requires IsListElement<T, Tag>
+    List<T, Tag, ConstantTimeSize>::iterator List<T, Tag, ConstantTimeSize>::GetIterator(T& element) {
+        return iterator(ToListElementBase(element));
+    }
+
+    template <typename T, typename Tag, bool ConstantTimeSize>
+    requires IsListElement<T, Tag>
+    List<T, Tag, ConstantTimeSize>::const_iterator List<T, Tag, ConstantTimeSize>::GetIterator(T& element) const {
+        return const_iterator(ToListElementBase(element));
     }
 
 
     // Iterator
-    template <typename T, typename Tag>
+    template <typename T, typename Tag, bool ConstantTimeSize>
     requires IsListElement<T, Tag>
     template <bool isConstType>
-    List<T, Tag>::Iterator<isConstType>::Iterator(ListElementBase* element) : current_element_(element) {}
+    List<T, Tag, ConstantTimeSize>::Iterator<isConstType>::Iterator(ListElementBase* element) : current_element_(element) {}
 
-    template <typename T, typename Tag>
+    template <typename T, typename Tag, bool ConstantTimeSize>
     requires IsListElement<T, Tag>
     template <bool isConstType>
     template <bool _isConstType>
     requires isConstType
-    List<T, Tag>::Iterator<isConstType>::Iterator(const Iterator<_isConstType>& other)
+    List<T, Tag, ConstantTimeSize>::Iterator<isConstType>::Iterator(const Iterator<_isConstType>& other)
         : current_element_(other.current_element_) {}
 
-    template <typename T, typename Tag>
+    template <typename T, typename Tag, bool ConstantTimeSize>
     requires IsListElement<T, Tag>
     template <bool isConstType>
-    List<T, Tag>::Iterator<isConstType>& List<T, Tag>::Iterator<isConstType>::operator++() {
+    List<T, Tag, ConstantTimeSize>::Iterator<isConstType>& List<T, Tag, ConstantTimeSize>::Iterator<isConstType>::operator++() {
         current_element_ = current_element_->next_;
         return *this;
     }
 
-    template <typename T, typename Tag>
+    template <typename T, typename Tag, bool ConstantTimeSize>
     requires IsListElement<T, Tag>
     template <bool isConstType>
-    List<T, Tag>::Iterator<isConstType>& List<T, Tag>::Iterator<isConstType>::operator--() {
+    List<T, Tag, ConstantTimeSize>::Iterator<isConstType>& List<T, Tag, ConstantTimeSize>::Iterator<isConstType>::operator--() {
         current_element_ = current_element_->prev_;
         return *this;
     }
 
-    template <typename T, typename Tag>
+    template <typename T, typename Tag, bool ConstantTimeSize>
     requires IsListElement<T, Tag>
     template <bool isConstType>
-    List<T, Tag>::Iterator<isConstType> List<T, Tag>::Iterator<isConstType>::operator++(int) {
+    List<T, Tag, ConstantTimeSize>::Iterator<isConstType> List<T, Tag, ConstantTimeSize>::Iterator<isConstType>::operator++(int) {
         current_element_ = current_element_->next_;
         return Iterator(current_element_->prev_);
     }
 
-    template <typename T, typename Tag>
+    template <typename T, typename Tag, bool ConstantTimeSize>
     requires IsListElement<T, Tag>
     template <bool isConstType>
-    List<T, Tag>::Iterator<isConstType> List<T, Tag>::Iterator<isConstType>::operator--(int) {
+    List<T, Tag, ConstantTimeSize>::Iterator<isConstType> List<T, Tag, ConstantTimeSize>::Iterator<isConstType>::operator--(int) {
         current_element_ = current_element_->prev_;
         return Iterator(current_element_->next_);
     }
 
-    template <typename T, typename Tag>
+    template <typename T, typename Tag, bool ConstantTimeSize>
     requires IsListElement<T, Tag>
     template <bool isConstType>
-    bool List<T, Tag>::Iterator<isConstType>::operator==(const Iterator& other) const noexcept {
+    bool List<T, Tag, ConstantTimeSize>::Iterator<isConstType>::operator==(const Iterator& other) const noexcept {
         return current_element_ == other.current_element_;
     }
 
-    template <typename T, typename Tag>
+    template <typename T, typename Tag, bool ConstantTimeSize>
     requires IsListElement<T, Tag>
     template <bool isConstType>
-    bool List<T, Tag>::Iterator<isConstType>::operator!=(const Iterator& other) const noexcept {
+    bool List<T, Tag, ConstantTimeSize>::Iterator<isConstType>::operator!=(const Iterator& other) const noexcept {
         return current_element_ != other.current_element_;
     }
 
-    template <typename T, typename Tag>
+    template <typename T, typename Tag, bool ConstantTimeSize>
     requires IsListElement<T, Tag>
     template <bool isConstType>
-    List<T, Tag>::Iterator<isConstType>::reference List<T, Tag>::Iterator<isConstType>::operator*() const {
-        return *static_cast<T*>((static_cast<ListElement<Tag>*>(current_element_)));
+    List<T, Tag, ConstantTimeSize>::Iterator<isConstType>::reference List<T, Tag, ConstantTimeSize>::Iterator<isConstType>::operator*() const {
+        return *ToTemplateType(current_element_);
     }
 
-    template <typename T, typename Tag>
+    template <typename T, typename Tag, bool ConstantTimeSize>
     requires IsListElement<T, Tag>
     template <bool isConstType>
-    List<T, Tag>::Iterator<isConstType>::pointer List<T, Tag>::Iterator<isConstType>::operator->() const {
-        return static_cast<T*>((static_cast<ListElement<Tag>*>(current_element_)));
+    List<T, Tag, ConstantTimeSize>::Iterator<isConstType>::pointer List<T, Tag, ConstantTimeSize>::Iterator<isConstType>::operator->() const {
+        return ToTemplateType(current_element_);
     }
 
 
-    template <typename T, typename Tag>
-    void swap(List<T, Tag>& first, List<T, Tag>& second) {
+    // Prefetch iterator
+    template <typename T, typename Tag, bool ConstantTimeSize>
+    requires IsListElement<T, Tag>
+    List<T, Tag, ConstantTimeSize>::PrefetchIterator::PrefetchIterator(ListElementBase* element, ListElementBase* ahead_element, const ListElementBase* end)
+        : current_element_(element), ahead_element_(ahead_element), end_(end) {}
+
+    template <typename T, typename Tag, bool ConstantTimeSize>
+    requires IsListElement<T, Tag>
+    List<T, Tag, ConstantTimeSize>::PrefetchIterator& List<T, Tag, ConstantTimeSize>::PrefetchIterator::operator++() {
+        current_element_ = current_element_->next_;
+        if (ahead_element_ != end_) {
+            ahead_element_ = ahead_element_->next_;
+            details::Prefetch(ahead_element_);
+        }
+        return *this;
+    }
+
+    template <typename T, typename Tag, bool ConstantTimeSize>
+    requires IsListElement<T, Tag>
+    bool List<T, Tag, ConstantTimeSize>::PrefetchIterator::operator==(const PrefetchIterator& other) const noexcept {
+        return current_element_ == other.current_element_;
+    }
+
+    template <typename T, typename Tag, bool ConstantTimeSize>
+    requires IsListElement<T, Tag>
+    bool List<T, Tag, ConstantTimeSize>::PrefetchIterator::operator!=(const PrefetchIterator& other) const noexcept {
+        return current_element_ != other.current_element_;
+    }
+
+    template <typename T, typename Tag, bool ConstantTimeSize>
+    requires IsListElement<T, Tag>
+    List<T, Tag, ConstantTimeSize>::PrefetchIterator::reference List<T, Tag, ConstantTimeSize>::PrefetchIterator::operator*() const {
+        return *ToTemplateType(current_element_);
+    }
+
+    template <typename T, typename Tag, bool ConstantTimeSize>
+    requires IsListElement<T, Tag>
+    List<T, Tag, ConstantTimeSize>::PrefetchIterator::pointer List<T, Tag, ConstantTimeSize>::PrefetchIterator::operator->() const {
+        return ToTemplateType(current_element_);
+    }
+
+    template <typename T, typename Tag, bool ConstantTimeSize>
+    requires IsListElement<T, Tag>
+    List<T, Tag, ConstantTimeSize>::PrefetchRange::PrefetchRange(List& list, size_t distance) : list_(list), distance_(distance) {}
+
+    template <typename T, typename Tag, bool ConstantTimeSize>
+    requires IsListElement<T, Tag>
+    List<T, Tag, ConstantTimeSize>::PrefetchIterator List<T, Tag, ConstantTimeSize>::PrefetchRange::begin() const {
+        ListElementBase* const end = &list_.empty_element_;
+        ListElementBase* ahead = end->next_;
+        for (size_t i = 0; i < distance_ && ahead != end; i++) {
+            ahead = ahead->next_;
+            details::Prefetch(ahead);
+        }
+        return PrefetchIterator(end->next_, ahead, end);
+    }
+
+    template <typename T, typename Tag, bool ConstantTimeSize>
+    requires IsListElement<T, Tag>
+    List<T, Tag, ConstantTimeSize>::PrefetchIterator List<T, Tag, ConstantTimeSize>::PrefetchRange::end() const {
+        ListElementBase* const end = &list_.empty_element_;
+        return PrefetchIterator(end, end, end);
+    }
+
+
+    template <typename T, typename Tag, bool ConstantTimeSize>
+    void swap(List<T, Tag, ConstantTimeSize>& first, List<T, Tag, ConstantTimeSize>& second) {
         first.Swap(second);
     }
 
@@ -0,0 +1,146 @@
+#ifndef CPP_IMPLEMENTATIONS_LRU_CACHE_H
+#define CPP_IMPLEMENTATIONS_LRU_CACHE_H
+
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include "intrusive_list.h"
+#include "hash_table.h"
+
+namespace cpp::intrusive {
+
+    // Intrusive LRU cache. Every element is linked into the recency list through ListElement<Tag>
+    // and into the bucket chain of the hash index through HashElement<Tag>.
+    // The index is sized for the capacity in the constructor, so it never rehashes and no operation allocates.
+    // The capacity must be positive.
+    // The cache does not own the elements: an evicted or erased element is returned to the caller.
+    template <typename T, typename Key, typename KeyOf, typename Hash = std::hash<Key>,
+              typename KeyEqual = std::equal_to<Key>, typename Tag = DefaultTag>
+    requires IsListElement<T, Tag> && IsHashElement<T, Tag>
+    class LruCache {
+    public:
+        explicit LruCache(size_t capacity, KeyOf key_of = KeyOf(), Hash hash = Hash(), KeyEqual key_equal = KeyEqual());
+
+        LruCache(const LruCache&) = delete;
+        LruCache(LruCache&&) = delete;
+        LruCache& operator=(const LruCache&) = delete;
+        LruCache& operator=(LruCache&&) = delete;
+
+        ~LruCache() = default;
+
+        // Returns the element with the given key and marks it as the most recently used
+        T* Find(const Key& key);
+
+        // Returns the element with the given key without touching it
+        T* Peek(const Key& key) const;
+
+        // Inserts the element as the most recently used. Returns false and leaves the cache untouched
+        // if the key is already present. evicted is set to the least recently used element
+        // if the cache was full, nullptr otherwise.
+        bool Insert(T& element, T*& evicted);
+
+        T* Erase(const Key& key);
+
+        // Removes and returns the least recently used element
+        T* EvictBack();
+
+        [[nodiscard]] size_t Size() const noexcept;
+        [[nodiscard]] size_t Capacity() const noexcept;
+        [[nodiscard]] bool IsEmpty() const noexcept;
+
+    private:
+        List<T, Tag, true> lru_list_;
+        HashMap<T, Key, KeyOf, Hash, KeyEqual, Tag> index_;
+        size_t capacity_;
+    };
+
+
+    // Implementation
+    template <typename T, typename Key, typename KeyOf, typename Hash, typename KeyEqual, typename Tag>
+    requires IsListElement<T, Tag> && IsHashElement<T, Tag>
+    LruCache<T, Key, KeyOf, Hash, KeyEqual, Tag>::LruCache(size_t capacity, KeyOf key_of, Hash hash, KeyEqual key_equal)
+            // One more slot for the element that is inserted before the eviction
+            : index_(capacity + 1, std::move(key_of), std::move(hash), std::move(key_equal)),
+              capacity_(capacity) {
+        assert(capacity > 0 && "The cache must hold at least one element");
+    }
+
+    template <typename T, typename Key, typename KeyOf, typename Hash, typename KeyEqual, typename Tag>
+    requires IsListElement<T, Tag> && IsHashElement<T, Tag>
+    T* LruCache<T, Key, KeyOf, Hash, KeyEqual, Tag>::Find(const Key& key) {
+        T* const result = index_.Find(key);
+        if (result == nullptr) {
+            return nullptr;
+        }
+        auto position = lru_list_.GetIterator(*result);
+        if (position != lru_list_.begin()) {
+            lru_list_.Splice(lru_list_.cbegin(), lru_list_, position, std::next(position), 0);
+        }
+        return result;
+    }
+
+    template <typename T, typename Key, typename KeyOf, typename Hash, typename KeyEqual, typename Tag>
+    requires IsListElement<T, Tag> && IsHashElement<T, Tag>
+    T* LruCache<T, Key, KeyOf, Hash, KeyEqual, Tag>::Peek(const Key& key) const {
+        return index_.Find(key);
+    }
+
+    template <typename T, typename Key, typename KeyOf, typename Hash, typename KeyEqual, typename Tag>
+    requires IsListElement<T, Tag> && IsHashElement<T, Tag>
+    bool LruCache<T, Key, KeyOf, Hash, KeyEqual, Tag>::Insert(T& element, T*& evicted) {
+        evicted = nullptr;
+        if (!index_.Insert(element)) {
+            return false;
+        }
+        // The element is not linked into the list yet, so it is never evicted itself
+        if (lru_list_.Size() >= capacity_) {
+            evicted = EvictBack();
+        }
+        lru_list_.PushFront(element);
+        return true;
+    }
+
+    template <typename T, typename Key, typename KeyOf, typename Hash, typename KeyEqual, typename Tag>
+    requires IsListElement<T, Tag> && IsHashElement<T, Tag>
+    T* LruCache<T, Key, KeyOf, Hash, KeyEqual, Tag>::Erase(const Key& key) {
+        T* const result = index_.Erase(key);
+        if (result == nullptr) {
+            return nullptr;
+        }
+        lru_list_.Erase(lru_list_.GetIterator(*result));
+        return result;
+    }
+
+    template <typename T, typename Key, typename KeyOf, typename Hash, typename KeyEqual, typename Tag>
+    requires IsListElement<T, Tag> && IsHashElement<T, Tag>
+    T* LruCache<T, Key, KeyOf, Hash, KeyEqual, Tag>::EvictBack() {
+        if (lru_list_.IsEmpty()) {
+            return nullptr;
+        }
+        T* const result = lru_list_.Back();
+        lru_list_.PopBack();
+        index_.Erase(*result);
+        return result;
+    }
+
+    template <typename T, typename Key, typename KeyOf, typename Hash, typename KeyEqual, typename Tag>
+    requires IsListElement<T, Tag> && IsHashElement<T, Tag>
+    size_t LruCache<T, Key, KeyOf, Hash, KeyEqual, Tag>::Size() const noexcept {
+        return lru_list_.Size();
+    }
+
+    template <typename T, typename Key, typename KeyOf, typename Hash, typename KeyEqual, typename Tag>
+    requires IsListElement<T, Tag> && IsHashElement<T, Tag>
+    size_t LruCache<T, Key, KeyOf, Hash, KeyEqual, Tag>::Capacity() const noexcept {
+        return capacity_;
+    }
+
+    template <typename T, typename Key, typename KeyOf, typename Hash, typename KeyEqual, typename Tag>
+    requires IsListElement<T, Tag> && IsHashElement<T, Tag>
+    bool LruCache<T, Key, KeyOf, Hash, KeyEqual, Tag>::IsEmpty() const noexcept {
+        return lru_list_.IsEmpty();
+    }
+
+} //End of namespace intrusive
+
+#endif //CPP_IMPLEMENTATIONS_LRU_CACHE_H
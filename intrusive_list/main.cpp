@@ -1,5 +1,18 @@
 #include <iostream>
+#include <deque>
+#include <string>
+#include <atomic>
+#include <thread>
+#include <vector>
 #include "intrusive_list.h"
+#include "mpsc_queue.h"
+#include "lru_cache.h"
+#include "hash_table.h"
+#include "timer_wheel.h"
+#include "slist.h"
+#include "node_pool.h"
+#include "concurrent_list.h"
+#include "rb_tree.h"
 
 class NodeTag;
 
@@ -14,7 +27,106 @@ public:
     int value_;
 };
 
+class TaskTag;
+
+struct Task : public cpp::intrusive::MpscQueueElement<TaskTag> {
+public:
+    explicit Task(int value) : value_(value) {}
+
+    int value_;
+};
+
+class UrgentTag;
+
+// Can be queued in two queues at once
+struct RoutedTask : public cpp::intrusive::MpscQueueElement<TaskTag>, public cpp::intrusive::MpscQueueElement<UrgentTag> {
+public:
+    explicit RoutedTask(int value) : value_(value) {}
+
+    int value_;
+};
+
+class EntryTag;
+
+struct Entry : public cpp::intrusive::ListElement<EntryTag>, public cpp::intrusive::HashElement<EntryTag> {
+public:
+    Entry(int key, std::string value) : key_(key), value_(std::move(value)) {}
+
+    int key_;
+    std::string value_;
+};
+
+struct EntryKey {
+    int operator()(const Entry& entry) const {
+        return entry.key_;
+    }
+};
+
+class WordTag;
+
+struct Word : public cpp::intrusive::HashElement<WordTag> {
+public:
+    explicit Word(int id) : id_(id) {}
+
+    int id_;
+};
+
+struct WordId {
+    int operator()(const Word& word) const {
+        return word.id_;
+    }
+};
+
+class BufferTag;
+
+struct Buffer : public cpp::intrusive::SListElement<BufferTag> {
+public:
+    explicit Buffer(int id) : id_(id) {}
+
+    int id_;
+};
+
+class SessionTag;
+
+struct Session : public cpp::intrusive::ConcurrentListElement<SessionTag> {
+public:
+    explicit Session(int id) : id_(id) {}
+
+    int id_;
+    std::atomic<bool> is_expired_{false};
+};
+
+class OrderTag;
+
+struct Order : public cpp::intrusive::ListElement<OrderTag>, public cpp::intrusive::RbTreeElement<OrderTag> {
+public:
+    Order(int price, int quantity) : price_(price), quantity_(quantity) {}
+
+    int price_;
+    int quantity_;
+};
+
+struct OrderPrice {
+    int operator()(const Order& order) const {
+        return order.price_;
+    }
+};
+
+class TimeoutTag;
+
+struct Timeout : public cpp::intrusive::TimerElement<TimeoutTag> {
+public:
+    explicit Timeout(std::string name) : name_(std::move(name)) {}
+
+    std::string name_;
+};
+
 int main() {
+    std::deque<Node> nodes;
+    for (int i = 0; i < 10; i++) {
+        nodes.emplace_back(i * 100);
+    }
+
     cpp::intrusive::List<Node, NodeTag> list;
 
     Node node1 = Node{1};
@@ -53,6 +165,243 @@ int main() {
             list.PopBack();
         }
     }
-    std::cout << list << std::endl;
+    std::cout << list << std::endl << std::endl;
+
+    cpp::intrusive::List<Node, NodeTag, true> first;
+    cpp::intrusive::List<Node, NodeTag, true> second;
+    for (int i = 0; i < 5; i++) {
+        first.PushBack(nodes[i]);
+        second.PushBack(nodes[i + 5]);
+    }
+
+    std::cout << "Splicing:" << std::endl;
+    first.Splice(first.cend(), second, ++second.cbegin(), --second.cend());
+    std::cout << first << " Size=" << first.Size() << std::endl;
+    std::cout << second << " Size=" << second.Size() << std::endl;
+
+    first.Splice(first.cbegin(), second);
+    std::cout << first << " Size=" << first.Size() << std::endl;
+    std::cout << second << " Size=" << second.Size() << std::endl;
+
+    // The range already starts at the position, the list stays the same
+    first.Splice(first.cbegin(), first, first.cbegin(), first.cend());
+    std::cout << first << " Size=" << first.Size() << std::endl;
+
+    while (!first.IsEmpty()) {
+        first.PopBack();
+    }
+
+    std::cout << "Moving with Insert:" << std::endl;
+    cpp::intrusive::List<Node, NodeTag> unsized_from;
+    cpp::intrusive::List<Node, NodeTag> unsized_to;
+    unsized_from.PushBack(nodes[0]);
+    unsized_from.PushBack(nodes[1]);
+    // Without ConstantTimeSize Insert unlinks the element from its list
+    unsized_to.Insert(unsized_to.begin(), nodes[1]);
+    std::cout << unsized_from << " Size=" << unsized_from.Size() << std::endl;
+    std::cout << unsized_to << " Size=" << unsized_to.Size() << std::endl;
+    unsized_from.PopBack();
+    unsized_to.PopBack();
+
+    cpp::intrusive::List<Node, NodeTag, true> sized_from;
+    cpp::intrusive::List<Node, NodeTag, true> sized_to;
+    sized_from.PushBack(nodes[0]);
+    sized_from.PushBack(nodes[1]);
+    // With ConstantTimeSize the element is erased first, so both sizes stay right
+    sized_from.Erase(sized_from.GetIterator(nodes[1]));
+    sized_to.Insert(sized_to.begin(), nodes[1]);
+    std::cout << sized_from << " Size=" << sized_from.Size() << std::endl;
+    std::cout << sized_to << " Size=" << sized_to.Size() << std::endl;
+    sized_from.PopBack();
+    sized_to.PopBack();
+
+    cpp::intrusive::MpscQueue<Task, TaskTag> queue;
+    Task task1{1};
+    Task task2{2};
+    queue.Push(task1);
+    queue.Push(task2);
+
+    std::cout << std::endl << "MpscQueue:" << std::endl;
+    while (Task* task = queue.TryPop()) {
+        std::cout << "Pop Task=[value=" << task->value_ << "]" << std::endl;
+    }
+
+    cpp::intrusive::MpscQueue<RoutedTask, TaskTag> routed_queue;
+    cpp::intrusive::MpscQueue<RoutedTask, UrgentTag> urgent_queue;
+    RoutedTask routed_task{3};
+    routed_queue.Push(routed_task);
+    urgent_queue.Push(routed_task);
+    RoutedTask* routed = routed_queue.TryPop();
+    RoutedTask* urgent = urgent_queue.TryPop();
+    std::cout << "Pop RoutedTask=[value=" << routed->value_ << "] from both queues, same task="
+              << std::boolalpha << (routed == urgent) << std::noboolalpha << std::endl;
+
+    cpp::intrusive::List<Node, NodeTag> sorted;
+    Node unsorted_nodes[] = {Node{5}, Node{1}, Node{4}, Node{3}};
+    for (Node& node : unsorted_nodes) {
+        sorted.PushBack(node);
+    }
+    auto by_value = [](const Node& first, const Node& second) {
+        return first.value_ < second.value_;
+    };
+    sorted.Sort(by_value);
+    Node node_to_insert{2};
+    sorted.InsertSorted(node_to_insert, by_value);
+    std::cout << std::endl << "Sorted: " << sorted << std::endl;
+
+    int sum = 0;
+    sorted.ForEachPrefetch([&sum](const Node& node) { sum += node.value_; });
+    std::cout << "Sum: " << sum << std::endl;
+
+    cpp::intrusive::NodePool<Node, 4> pool;
+    cpp::intrusive::List<Node, NodeTag> pooled;
+    for (int i = 0; i < 6; i++) {
+        pooled.PushFront(*pool.Create(i));
+    }
+    pool.Destroy(pooled.Front());
+    pooled.PushBack(*pool.Create(10));
+    cpp::intrusive::NodePool<Node, 4>::Compact(pooled);
+    std::cout << "Pooled in memory order: " << pooled << std::endl;
+    std::cout << "Pool size: " << pool.Size() << ", capacity: " << pool.Capacity() << std::endl;
+    while (!pooled.IsEmpty()) {
+        Node* node = pooled.Front();
+        pooled.PopFront();
+        pool.Destroy(node);
+    }
+
+    cpp::intrusive::LruCache<Entry, int, EntryKey, std::hash<int>, std::equal_to<int>, EntryTag> cache{2};
+    Entry entry1{1, "one"};
+    Entry entry2{2, "two"};
+    Entry entry3{3, "three"};
+
+    std::cout << std::endl << "LruCache:" << std::endl;
+    Entry* evicted = nullptr;
+    cache.Insert(entry1, evicted);
+    cache.Insert(entry2, evicted);
+    std::cout << "Find 1: " << cache.Find(1)->value_ << std::endl;
+    // 1 is already the most recently used
+    std::cout << "Find 1 again: " << cache.Find(1)->value_ << ", size: " << cache.Size() << std::endl;
+    cache.Insert(entry3, evicted);
+    std::cout << "Insert 3, evicted: " << evicted->value_ << std::endl;
+    std::cout << "Find 2: " << (cache.Find(2) == nullptr ? "miss" : "hit") << std::endl;
+    Entry duplicate{3, "three again"};
+    std::cout << "Insert duplicate 3: " << std::boolalpha << cache.Insert(duplicate, evicted) << std::noboolalpha
+              << ", evicted: " << (evicted == nullptr ? "none" : evicted->value_) << ", size: " << cache.Size() << std::endl;
+    cache.Erase(1);
+    cache.Erase(3);
+
+    cpp::intrusive::HashMap<Word, int, WordId, std::hash<int>, std::equal_to<int>, WordTag> words;
+    std::deque<Word> word_storage;
+    for (int i = 0; i < 100; i++) {
+        words.Insert(word_storage.emplace_back(i));
+    }
+
+    std::cout << std::endl << "HashMap:" << std::endl;
+    std::cout << "Size: " << words.Size() << ", buckets: " << words.BucketsCount()
+              << ", rehashing: " << std::boolalpha << words.IsRehashing() << std::endl;
+    std::cout << "Insert duplicate 7: " << words.Insert(word_storage.emplace_back(7)) << std::endl;
+    std::cout << "Find 42: " << words.Find(42)->id_ << std::endl;
+    words.Erase(word_storage[10]);
+    std::cout << "Erase 10, find 10: " << (words.Find(10) == nullptr ? "miss" : "hit") << std::endl;
+    for (int i = 0; i < 100; i++) {
+        words.Erase(i);
+    }
+    std::cout << "Size after erasing: " << words.Size() << std::endl;
+
+    cpp::intrusive::TimerWheel<Timeout, TimeoutTag> wheel;
+    Timeout read_timeout{"read"};
+    Timeout write_timeout{"write"};
+    Timeout idle_timeout{"idle"};
+    wheel.Schedule(read_timeout, 100);
+    wheel.Schedule(write_timeout, 300);
+    wheel.Schedule(idle_timeout, 70'000);
+    wheel.Cancel(write_timeout);
+
+    std::cout << std::endl << "TimerWheel:" << std::endl;
+    auto print_timeout = [&wheel](Timeout& timeout) {
+        std::cout << "Tick " << wheel.Now() << ": " << timeout.name_ << " expired" << std::endl;
+    };
+    wheel.Advance(1'000, print_timeout);
+    std::cout << "Scheduled: " << wheel.Size() << std::endl;
+    wheel.Advance(100'000, print_timeout);
+
+    Buffer buffer1{1};
+    Buffer buffer2{2};
+    Buffer buffer3{3};
+    cpp::intrusive::SList<Buffer, BufferTag, true> pending;
+    pending.PushBack(buffer1);
+    pending.PushBack(buffer2);
+    pending.PushFront(buffer3);
+
+    std::cout << std::endl << "SList:" << std::endl;
+    for (const Buffer& buffer : pending) {
+        std::cout << "Buffer=[id=" << buffer.id_ << "]" << std::endl;
+    }
+
+    cpp::intrusive::Stack<Buffer, BufferTag> free_buffers;
+    while (!pending.IsEmpty()) {
+        Buffer* buffer = pending.Front();
+        pending.PopFront();
+        free_buffers.Push(*buffer);
+    }
+
+    std::cout << std::endl << "Stack:" << std::endl;
+    while (Buffer* buffer = free_buffers.Pop()) {
+        std::cout << "Pop Buffer=[id=" << buffer->id_ << "]" << std::endl;
+    }
+
+    std::deque<Session> session_storage;
+    for (int i = 0; i < 6; i++) {
+        session_storage.emplace_back(i);
+    }
+    cpp::intrusive::ConcurrentList<Session, SessionTag> sessions;
+    std::vector<std::thread> workers;
+    for (size_t i = 0; i < session_storage.size(); i += 2) {
+        workers.emplace_back([&sessions, &session_storage, i] {
+            sessions.PushBack(session_storage[i]);
+            sessions.PushFront(session_storage[i + 1]);
+            session_storage[i + 1].is_expired_ = true;
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    std::cout << std::endl << "ConcurrentList:" << std::endl;
+    const size_t reaped_count = sessions.RemoveIf([](const Session& session) {
+        return session.is_expired_.load();
+    });
+    std::cout << "Reaped: " << reaped_count << std::endl;
+    sessions.ForEach([](const Session& session) {
+        std::cout << "Session=[id=" << session.id_ << "]" << std::endl;
+    });
+    for (Session& session : session_storage) {
+        std::cout << "Unlink Session=[id=" << session.id_ << "]: " << sessions.Unlink(session) << std::endl;
+    }
+
+    std::deque<Order> orders;
+    orders.emplace_back(101, 5);
+    orders.emplace_back(99, 10);
+    orders.emplace_back(100, 7);
+    orders.emplace_back(99, 3);
+    cpp::intrusive::List<Order, OrderTag> arrivals;
+    cpp::intrusive::RbTree<Order, int, OrderPrice, std::less<int>, OrderTag> by_price;
+    for (Order& order : orders) {
+        arrivals.PushBack(order);
+        by_price.Insert(order);
+    }
+
+    std::cout << std::endl << "RbTree:" << std::endl;
+    for (const Order& order : by_price) {
+        std::cout << "Order=[price=" << order.price_ << ", quantity=" << order.quantity_ << "]" << std::endl;
+    }
+    std::cout << "Lower bound of 100: " << by_price.LowerBound(100)->quantity_ << std::endl;
+
+    // Cancel the oldest order in both indexes
+    Order& oldest = *arrivals.Front();
+    arrivals.PopFront();
+    by_price.Erase(oldest);
+    std::cout << "Highest price after cancel: " << by_price.Back()->price_ << std::endl;
+    by_price.Clear();
     return 0;
 }
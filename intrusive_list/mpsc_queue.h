@@ -0,0 +1,165 @@
+#ifndef CPP_IMPLEMENTATIONS_MPSC_QUEUE_H
+#define CPP_IMPLEMENTATIONS_MPSC_QUEUE_H
+
+#include <atomic>
+#include <type_traits>
+#include "intrusive_list.h"
+
+namespace cpp::intrusive {
+
+    template <typename Tag = DefaultTag>
+    class MpscQueueElement;
+
+    template <typename T, typename Tag>
+    concept IsMpscQueueElement = std::is_base_of_v<MpscQueueElement<Tag>, T>;
+
+    template <typename T, typename Tag = DefaultTag>
+    requires IsMpscQueueElement<T, Tag>
+    class MpscQueue;
+
+
+    class MpscQueueElementBase {
+    protected:
+        MpscQueueElementBase() = default;
+        ~MpscQueueElementBase() = default;
+
+    private:
+        std::atomic<MpscQueueElementBase*> next_{nullptr};
+
+        template <typename T, typename Tag>
+        requires IsMpscQueueElement<T, Tag>
+        friend class MpscQueue;
+
+    };
+
+    // Unlike ListElement the hook is not unlinked on destruction:
+    // an element must be popped from the queue before it is destroyed.
+    template <typename Tag>
+    class MpscQueueElement : private MpscQueueElementBase {
+    protected:
+        MpscQueueElement() = default;
+        ~MpscQueueElement() = default;
+
+    public:
+        MpscQueueElement(const MpscQueueElement&) = delete;
+        MpscQueueElement(const MpscQueueElement&&) = delete;
+        MpscQueueElement& operator=(const MpscQueueElement&) = delete;
+        MpscQueueElement& operator=(const MpscQueueElement&&) = delete;
+
+        template <typename T, typename Tag_>
+        requires IsMpscQueueElement<T, Tag_>
+        friend class MpscQueue;
+
+    };
+
+
+    // Dmitry Vyukov's intrusive multi-producer single-consumer queue.
+    // Push is wait-free and can be called from any thread, TryPop must be called from a single consumer thread.
+    template <typename T, typename Tag>
+    requires IsMpscQueueElement<T, Tag>
+    class MpscQueue {
+    public:
+        MpscQueue() = default;
+
+        MpscQueue(const MpscQueue&) = delete;
+        MpscQueue(MpscQueue&&) = delete;
+        MpscQueue& operator=(const MpscQueue&) = delete;
+        MpscQueue& operator=(MpscQueue&&) = delete;
+
+        ~MpscQueue() = default;
+
+        void Push(T& element) noexcept;
+
+        // Returns nullptr if the queue is empty or if a producer has not finished its Push yet
+        T* TryPop() noexcept;
+
+        [[nodiscard]] bool IsEmpty() const noexcept;
+
+    private:
+        void PushBase(MpscQueueElementBase* element) noexcept;
+
+        static MpscQueueElementBase* ToQueueElementBase(T& element) noexcept;
+        static T* ToTemplateType(MpscQueueElementBase* queue_element_base) noexcept;
+
+        class Stub : public MpscQueueElementBase {};
+
+    private:
+        static constexpr size_t kCacheLineSize = 64;
+
+        alignas(kCacheLineSize) std::atomic<MpscQueueElementBase*> head_{&stub_};
+        alignas(kCacheLineSize) MpscQueueElementBase* tail_{&stub_};
+        // Producers write the next pointer of the stub, so it does not share the line of the consumer
+        alignas(kCacheLineSize) Stub stub_{};
+    };
+
+
+    // Implementation
+    template <typename T, typename Tag>
+    requires IsMpscQueueElement<T, Tag>
+    void MpscQueue<T, Tag>::Push(T& element) noexcept {
+        PushBase(ToQueueElementBase(element));
+    }
+
+    template <typename T, typename Tag>
+    requires IsMpscQueueElement<T, Tag>
+    T* MpscQueue<T, Tag>::TryPop() noexcept {
+        MpscQueueElementBase* tail = tail_;
+        MpscQueueElementBase* next = tail->next_.load(std::memory_order_acquire);
+
+        if (tail == &stub_) {
+            if (next == nullptr) {
+                return nullptr;
+            }
+            tail_ = next;
+            tail = next;
+            next = next->next_.load(std::memory_order_acquire);
+        }
+
+        if (next != nullptr) {
+            tail_ = next;
+            return ToTemplateType(tail);
+        }
+
+        if (tail != head_.load(std::memory_order_acquire)) {
+            return nullptr;
+        }
+
+        PushBase(&stub_);
+
+        next = tail->next_.load(std::memory_order_acquire);
+        if (next != nullptr) {
+            tail_ = next;
+            return ToTemplateType(tail);
+        }
+        return nullptr;
+    }
+
+    template <typename T, typename Tag>
+    requires IsMpscQueueElement<T, Tag>
+    bool MpscQueue<T, Tag>::IsEmpty() const noexcept {
+        return tail_ == &stub_ && stub_.next_.load(std::memory_order_acquire) == nullptr;
+    }
+
+    template <typename T, typename Tag>
+    requires IsMpscQueueElement<T, Tag>
+    void MpscQueue<T, Tag>::PushBase(MpscQueueElementBase* element) noexcept {
+        element->next_.store(nullptr, std::memory_order_relaxed);
+        MpscQueueElementBase* const prev = head_.exchange(element, std::memory_order_acq_rel);
+        prev->next_.store(element, std::memory_order_release);
+    }
+
+    template <typename T, typename Tag>
+    requires IsMpscQueueElement<T, Tag>
+    MpscQueueElementBase* MpscQueue<T, Tag>::ToQueueElementBase(T& element) noexcept {
+        return static_cast<MpscQueueElementBase*>(static_cast<MpscQueueElement<Tag>*>(&element));
+    }
+
+    template <typename T, typename Tag>
+    requires IsMpscQueueElement<T, Tag>
+    T* MpscQueue<T, Tag>::ToTemplateType(MpscQueueElementBase* queue_element_base) noexcept {
+        return static_cast<T*>(static_cast<MpscQueueElement<Tag>*>(queue_element_base));
+    }
+
+} //End of namespace intrusive
+
+#endif //CPP_IMPLEMENTATIONS_MPSC_QUEUE_H
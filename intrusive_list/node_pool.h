@@ -0,0 +1,131 @@
+#ifndef CPP_IMPLEMENTATIONS_NODE_POOL_H
+#define CPP_IMPLEMENTATIONS_NODE_POOL_H
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+#include "intrusive_list.h"
+
+namespace cpp::intrusive {
+
+    // Pool of nodes of an intrusive container. The nodes are constructed in chunks of ChunkSize slots,
+    // so nodes created one after another are adjacent in memory. Destroyed nodes are recycled through
+    // a free list threaded through their slots. The pool must outlive the nodes it created.
+    template <typename T, size_t ChunkSize = 1024>
+    requires (ChunkSize > 0)
+    class NodePool {
+    public:
+        NodePool() = default;
+
+        NodePool(const NodePool&) = delete;
+        NodePool(NodePool&&) = delete;
+        NodePool& operator=(const NodePool&) = delete;
+        NodePool& operator=(NodePool&&) = delete;
+
+        ~NodePool() = default;
+
+        template <typename... Args>
+        T* Create(Args&&... args);
+
+        void Destroy(T* node) noexcept;
+
+        // Relinks the list in the memory order of its nodes, so traversal walks the chunks sequentially.
+        // Only the links change, the nodes stay where they are.
+        template <typename Tag, bool ConstantTimeSize>
+        static void Compact(List<T, Tag, ConstantTimeSize>& list);
+
+        // Returns the number of live nodes
+        [[nodiscard]] size_t Size() const noexcept;
+
+        // Returns the number of slots in all chunks
+        [[nodiscard]] size_t Capacity() const noexcept;
+
+    private:
+        union Slot {
+            Slot() {}
+            ~Slot() {}
+
+            Slot* next_free;
+            alignas(T) std::byte storage[sizeof(T)];
+        };
+
+        Slot* AllocateSlot();
+
+    private:
+        std::vector<std::unique_ptr<Slot[]>> chunks_;
+        Slot* free_slots_{nullptr};
+        Slot* next_unused_slot_{nullptr};
+        Slot* chunk_end_{nullptr};
+        size_t size_{0};
+    };
+
+
+    // Implementation
+    template <typename T, size_t ChunkSize>
+    requires (ChunkSize > 0)
+    template <typename... Args>
+    T* NodePool<T, ChunkSize>::Create(Args&&... args) {
+        Slot* const slot = AllocateSlot();
+        T* node;
+        try {
+            node = ::new (static_cast<void*>(slot->storage)) T(std::forward<Args>(args)...);
+        } catch (...) {
+            slot->next_free = free_slots_;
+            free_slots_ = slot;
+            throw;
+        }
+        ++size_;
+        return node;
+    }
+
+    template <typename T, size_t ChunkSize>
+    requires (ChunkSize > 0)
+    void NodePool<T, ChunkSize>::Destroy(T* node) noexcept {
+        node->~T();
+        Slot* const slot = reinterpret_cast<Slot*>(node);
+        slot->next_free = free_slots_;
+        free_slots_ = slot;
+        --size_;
+    }
+
+    template <typename T, size_t ChunkSize>
+    requires (ChunkSize > 0)
+    template <typename Tag, bool ConstantTimeSize>
+    void NodePool<T, ChunkSize>::Compact(List<T, Tag, ConstantTimeSize>& list) {
+        list.Sort([](const T& first, const T& second) {
+            return std::less<const T*>()(&first, &second);
+        });
+    }
+
+    template <typename T, size_t ChunkSize>
+    requires (ChunkSize > 0)
+    size_t NodePool<T, ChunkSize>::Size() const noexcept {
+        return size_;
+    }
+
+    template <typename T, size_t ChunkSize>
+    requires (ChunkSize > 0)
+    size_t NodePool<T, ChunkSize>::Capacity() const noexcept {
+        return chunks_.size() * ChunkSize;
+    }
+
+    template <typename T, size_t ChunkSize>
+    requires (ChunkSize > 0)
+    NodePool<T, ChunkSize>::Slot* NodePool<T, ChunkSize>::AllocateSlot() {
+        if (free_slots_ != nullptr) {
+            return std::exchange(free_slots_, free_slots_->next_free);
+        }
+        if (next_unused_slot_ == chunk_end_) {
+            chunks_.push_back(std::make_unique<Slot[]>(ChunkSize));
+            next_unused_slot_ = chunks_.back().get();
+            chunk_end_ = next_unused_slot_ + ChunkSize;
+        }
+        return next_unused_slot_++;
+    }
+
+} //End of namespace intrusive
+
+#endif //CPP_IMPLEMENTATIONS_NODE_POOL_H
@@ -0,0 +1,292 @@
+#include <utility>
+#include "rb_tree.h"
+
+namespace cpp::intrusive {
+
+    RbTreeElementBase* RbTreeElementBase::Next(RbTreeElementBase* element) noexcept {
+        if (element->right_ != nullptr) {
+            element = element->right_;
+            while (element->left_ != nullptr) {
+                element = element->left_;
+            }
+            return element;
+        }
+        RbTreeElementBase* parent = element->parent_;
+        while (element == parent->right_) {
+            element = parent;
+            parent = parent->parent_;
+        }
+        // The rightmost element climbs to the header and then to the root, whose right child is not the header
+        return element->right_ != parent ? parent : element;
+    }
+
+    RbTreeElementBase* RbTreeElementBase::Prev(RbTreeElementBase* element) noexcept {
+        if (element->is_red_ && element->parent_->parent_ == element) {
+            // The header
+            return element->right_;
+        }
+        if (element->left_ != nullptr) {
+            element = element->left_;
+            while (element->right_ != nullptr) {
+                element = element->right_;
+            }
+            return element;
+        }
+        RbTreeElementBase* parent = element->parent_;
+        while (element == parent->left_) {
+            element = parent;
+            parent = parent->parent_;
+        }
+        return parent;
+    }
+
+    void RbTreeElementBase::InsertAndRebalance(bool insert_left, RbTreeElementBase* element,
+                                               RbTreeElementBase* parent, RbTreeElementBase& header) noexcept {
+        RbTreeElementBase*& root = header.parent_;
+
+        element->parent_ = parent;
+        element->left_ = element->right_ = nullptr;
+        element->is_red_ = true;
+
+        if (insert_left) {
+            // The left child of the header is the leftmost element, so this also handles the empty tree
+            parent->left_ = element;
+            if (parent == &header) {
+                header.parent_ = element;
+                header.right_ = element;
+            } else if (parent == header.left_) {
+                header.left_ = element;
+            }
+        } else {
+            parent->right_ = element;
+            if (parent == header.right_) {
+                header.right_ = element;
+            }
+        }
+
+        while (element != root && element->parent_->is_red_) {
+            RbTreeElementBase* const grandparent = element->parent_->parent_;
+            if (element->parent_ == grandparent->left_) {
+                RbTreeElementBase* const uncle = grandparent->right_;
+                if (uncle != nullptr && uncle->is_red_) {
+                    element->parent_->is_red_ = false;
+                    uncle->is_red_ = false;
+                    grandparent->is_red_ = true;
+                    element = grandparent;
+                } else {
+                    if (element == element->parent_->right_) {
+                        element = element->parent_;
+                        RotateLeft(element, root);
+                    }
+                    element->parent_->is_red_ = false;
+                    grandparent->is_red_ = true;
+                    RotateRight(grandparent, root);
+                }
+            } else {
+                RbTreeElementBase* const uncle = grandparent->left_;
+                if (uncle != nullptr && uncle->is_red_) {
+                    element->parent_->is_red_ = false;
+                    uncle->is_red_ = false;
+                    grandparent->is_red_ = true;
+                    element = grandparent;
+                } else {
+                    if (element == element->parent_->left_) {
+                        element = element->parent_;
+                        RotateRight(element, root);
+                    }
+                    element->parent_->is_red_ = false;
+                    grandparent->is_red_ = true;
+                    RotateLeft(grandparent, root);
+                }
+            }
+        }
+        root->is_red_ = false;
+    }
+
+    void RbTreeElementBase::EraseAndRebalance(RbTreeElementBase* element, RbTreeElementBase& header) noexcept {
+        RbTreeElementBase*& root = header.parent_;
+        RbTreeElementBase*& leftmost = header.left_;
+        RbTreeElementBase*& rightmost = header.right_;
+
+        // removed is the element that leaves its place: the element itself or its successor
+        RbTreeElementBase* removed = element;
+        RbTreeElementBase* child;
+        RbTreeElementBase* child_parent;
+
+        if (removed->left_ == nullptr) {
+            child = removed->right_;
+        } else if (removed->right_ == nullptr) {
+            child = removed->left_;
+        } else {
+            removed = removed->right_;
+            while (removed->left_ != nullptr) {
+                removed = removed->left_;
+            }
+            child = removed->right_;
+        }
+
+        if (removed != element) {
+            // The successor takes the place and the color of the element
+            element->left_->parent_ = removed;
+            removed->left_ = element->left_;
+            if (removed != element->right_) {
+                child_parent = removed->parent_;
+                if (child != nullptr) {
+                    child->parent_ = removed->parent_;
+                }
+                removed->parent_->left_ = child;
+                removed->right_ = element->right_;
+                element->right_->parent_ = removed;
+            } else {
+                child_parent = removed;
+            }
+            if (root == element) {
+                root = removed;
+            } else if (element->parent_->left_ == element) {
+                element->parent_->left_ = removed;
+            } else {
+                element->parent_->right_ = removed;
+            }
+            removed->parent_ = element->parent_;
+            std::swap(removed->is_red_, element->is_red_);
+        } else {
+            child_parent = element->parent_;
+            if (child != nullptr) {
+                child->parent_ = element->parent_;
+            }
+            if (root == element) {
+                root = child;
+            } else if (element->parent_->left_ == element) {
+                element->parent_->left_ = child;
+            } else {
+                element->parent_->right_ = child;
+            }
+            if (leftmost == element) {
+                if (element->right_ == nullptr) {
+                    leftmost = element->parent_;
+                } else {
+                    leftmost = child;
+                    while (leftmost->left_ != nullptr) {
+                        leftmost = leftmost->left_;
+                    }
+                }
+            }
+            if (rightmost == element) {
+                if (element->left_ == nullptr) {
+                    rightmost = element->parent_;
+                } else {
+                    rightmost = child;
+                    while (rightmost->right_ != nullptr) {
+                        rightmost = rightmost->right_;
+                    }
+                }
+            }
+        }
+
+        // After the swap element holds the color of the position that was removed from the tree
+        if (!element->is_red_) {
+            while (child != root && (child == nullptr || !child->is_red_)) {
+                if (child == child_parent->left_) {
+                    RbTreeElementBase* sibling = child_parent->right_;
+                    if (sibling->is_red_) {
+                        sibling->is_red_ = false;
+                        child_parent->is_red_ = true;
+                        RotateLeft(child_parent, root);
+                        sibling = child_parent->right_;
+                    }
+                    if ((sibling->left_ == nullptr || !sibling->left_->is_red_) &&
+                        (sibling->right_ == nullptr || !sibling->right_->is_red_)) {
+                        sibling->is_red_ = true;
+                        child = child_parent;
+                        child_parent = child_parent->parent_;
+                    } else {
+                        if (sibling->right_ == nullptr || !sibling->right_->is_red_) {
+                            sibling->left_->is_red_ = false;
+                            sibling->is_red_ = true;
+                            RotateRight(sibling, root);
+                            sibling = child_parent->right_;
+                        }
+                        sibling->is_red_ = child_parent->is_red_;
+                        child_parent->is_red_ = false;
+                        if (sibling->right_ != nullptr) {
+                            sibling->right_->is_red_ = false;
+                        }
+                        RotateLeft(child_parent, root);
+                        break;
+                    }
+                } else {
+                    RbTreeElementBase* sibling = child_parent->left_;
+                    if (sibling->is_red_) {
+                        sibling->is_red_ = false;
+                        child_parent->is_red_ = true;
+                        RotateRight(child_parent, root);
+                        sibling = child_parent->left_;
+                    }
+                    if ((sibling->right_ == nullptr || !sibling->right_->is_red_) &&
+                        (sibling->left_ == nullptr || !sibling->left_->is_red_)) {
+                        sibling->is_red_ = true;
+                        child = child_parent;
+                        child_parent = child_parent->parent_;
+                    } else {
+                        if (sibling->left_ == nullptr || !sibling->left_->is_red_) {
+                            sibling->right_->is_red_ = false;
+                            sibling->is_red_ = true;
+                            RotateLeft(sibling, root);
+                            sibling = child_parent->left_;
+                        }
+                        sibling->is_red_ = child_parent->is_red_;
+                        child_parent->is_red_ = false;
+                        if (sibling->left_ != nullptr) {
+                            sibling->left_->is_red_ = false;
+                        }
+                        RotateRight(child_parent, root);
+                        break;
+                    }
+                }
+            }
+            if (child != nullptr) {
+                child->is_red_ = false;
+            }
+        }
+
+        element->parent_ = element->left_ = element->right_ = nullptr;
+        element->is_red_ = false;
+    }
+
+    void RbTreeElementBase::RotateLeft(RbTreeElementBase* element, RbTreeElementBase*& root) noexcept {
+        RbTreeElementBase* const right = element->right_;
+        element->right_ = right->left_;
+        if (right->left_ != nullptr) {
+            right->left_->parent_ = element;
+        }
+        right->parent_ = element->parent_;
+        if (element == root) {
+            root = right;
+        } else if (element == element->parent_->left_) {
+            element->parent_->left_ = right;
+        } else {
+            element->parent_->right_ = right;
+        }
+        right->left_ = element;
+        element->parent_ = right;
+    }
+
+    void RbTreeElementBase::RotateRight(RbTreeElementBase* element, RbTreeElementBase*& root) noexcept {
+        RbTreeElementBase* const left = element->left_;
+        element->left_ = left->right_;
+        if (left->right_ != nullptr) {
+            left->right_->parent_ = element;
+        }
+        left->parent_ = element->parent_;
+        if (element == root) {
+            root = left;
+        } else if (element == element->parent_->right_) {
+            element->parent_->right_ = left;
+        } else {
+            element->parent_->left_ = left;
+        }
+        left->right_ = element;
+        element->parent_ = left;
+    }
+
+} //End of namespace intrusive
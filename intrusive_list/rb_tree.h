@@ -0,0 +1,549 @@
+#ifndef CPP_IMPLEMENTATIONS_RB_TREE_H
+#define CPP_IMPLEMENTATIONS_RB_TREE_H
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include "intrusive_list.h"
+
+namespace cpp::intrusive {
+
+    template <typename Tag = DefaultTag>
+    class RbTreeElement;
+
+    template <typename T, typename Tag>
+    concept IsRbTreeElement = std::is_base_of_v<RbTreeElement<Tag>, T>;
+
+    template <typename T, typename Key, typename KeyOf, typename Compare = std::less<Key>, typename Tag = DefaultTag>
+    requires IsRbTreeElement<T, Tag>
+    class RbTree;
+
+
+    // Hook of the intrusive red-black tree. Unlike ListElement the hook is not unlinked on destruction:
+    // an element must be erased from the tree before it is destroyed.
+    class RbTreeElementBase {
+    protected:
+        RbTreeElementBase() = default;
+        ~RbTreeElementBase() = default;
+
+        [[nodiscard]] bool IsLinked() const noexcept {
+            return parent_ != nullptr;
+        }
+
+    private:
+        // The header of the tree is the end of the in-order traversal:
+        // its parent is the root, its left and right children are the leftmost and the rightmost elements
+        static RbTreeElementBase* Next(RbTreeElementBase* element) noexcept;
+        static RbTreeElementBase* Prev(RbTreeElementBase* element) noexcept;
+
+        static void InsertAndRebalance(bool insert_left, RbTreeElementBase* element,
+                                       RbTreeElementBase* parent, RbTreeElementBase& header) noexcept;
+        static void EraseAndRebalance(RbTreeElementBase* element, RbTreeElementBase& header) noexcept;
+
+        static void RotateLeft(RbTreeElementBase* element, RbTreeElementBase*& root) noexcept;
+        static void RotateRight(RbTreeElementBase* element, RbTreeElementBase*& root) noexcept;
+
+    private:
+        RbTreeElementBase* parent_{nullptr};
+        RbTreeElementBase* left_{nullptr};
+        RbTreeElementBase* right_{nullptr};
+        bool is_red_{false};
+
+        template <typename T, typename Key, typename KeyOf, typename Compare, typename Tag>
+        requires IsRbTreeElement<T, Tag>
+        friend class RbTree;
+
+    };
+
+    template <typename Tag>
+    class RbTreeElement : private RbTreeElementBase {
+    protected:
+        RbTreeElement() = default;
+        ~RbTreeElement() = default;
+
+    public:
+        RbTreeElement(const RbTreeElement&) = delete;
+        RbTreeElement(const RbTreeElement&&) = delete;
+        RbTreeElement& operator=(const RbTreeElement&) = delete;
+        RbTreeElement& operator=(const RbTreeElement&&) = delete;
+
+        using RbTreeElementBase::IsLinked;
+
+        template <typename T, typename Key, typename KeyOf, typename Compare, typename Tag_>
+        requires IsRbTreeElement<T, Tag_>
+        friend class RbTree;
+
+    };
+
+
+    // Intrusive red-black tree ordered by the keys that KeyOf extracts from the elements.
+    // Equal keys are allowed and kept in the insertion order. The tree never allocates.
+    template <typename T, typename Key, typename KeyOf, typename Compare, typename Tag>
+    requires IsRbTreeElement<T, Tag>
+    class RbTree {
+    private:
+        template <bool isConstType>
+        class Iterator;
+
+    public:
+        using iterator = Iterator<false>;
+        using const_iterator = Iterator<true>;
+
+        explicit RbTree(KeyOf key_of = KeyOf(), Compare compare = Compare());
+
+        RbTree(const RbTree&) = delete;
+        RbTree& operator=(const RbTree&) = delete;
+
+        RbTree(RbTree&&) = delete;
+        RbTree& operator=(RbTree&&) = delete;
+
+        ~RbTree();
+
+        [[nodiscard]] bool IsEmpty() const noexcept;
+        [[nodiscard]] size_t Size() const noexcept;
+
+        // Return the element with the smallest / the largest key. The tree must not be empty.
+        T* Front() const noexcept;
+        T* Back() const noexcept;
+
+        // Inserts the element after the elements with equal keys
+        iterator Insert(T& element);
+
+        // Returns false and leaves the tree unchanged if an element with an equal key is already present
+        std::pair<iterator, bool> InsertUnique(T& element);
+
+        iterator Erase(const_iterator position) noexcept;
+        void Erase(T& element) noexcept;
+
+        // Unlinks all elements in O(n)
+        void Clear() noexcept;
+
+        iterator Find(const Key& key);
+        const_iterator Find(const Key& key) const;
+
+        // Returns the first element with the key not less than / greater than the given key
+        iterator LowerBound(const Key& key);
+        const_iterator LowerBound(const Key& key) const;
+        iterator UpperBound(const Key& key);
+        const_iterator UpperBound(const Key& key) const;
+
+        iterator begin();
+        iterator end();
+        const_iterator begin() const;
+        const_iterator end() const;
+        const_iterator cbegin() const;
+        const_iterator cend() const;
+
+        iterator GetIterator(T& element);
+        const_iterator GetIterator(const T& element) const;
+
+    private:
+        RbTreeElementBase* FindNode(const Key& key) const;
+        RbTreeElementBase* LowerBoundNode(const Key& key) const;
+        RbTreeElementBase* UpperBoundNode(const Key& key) const;
+
+        decltype(auto) KeyOfNode(RbTreeElementBase* element) const;
+
+        RbTreeElementBase* Header() const noexcept;
+
+        static RbTreeElementBase* ToRbTreeElementBase(const T& element) noexcept;
+        static T* ToTemplateType(RbTreeElementBase* element) noexcept;
+
+        class Sentinel : public RbTreeElementBase {};
+
+        template <bool isConstType>
+        class Iterator {
+        public:
+            using iterator_category = std::bidirectional_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = std::conditional_t<isConstType, const T*, T*>;
+            using reference = std::conditional_t<isConstType, const T&, T&>;
+
+            explicit Iterator(RbTreeElementBase* element);
+
+            template <bool _isConstType>
+            requires isConstType
+            Iterator(const Iterator<_isConstType>& other);
+
+            Iterator& operator++();
+            Iterator& operator--();
+            Iterator operator++(int);
+            Iterator operator--(int);
+
+            bool operator==(const Iterator& other) const noexcept;
+            bool operator!=(const Iterator& other) const noexcept;
+
+            reference operator*() const;
+            pointer operator->() const;
+
+            friend class RbTree;
+
+        private:
+            RbTreeElementBase* current_element_;
+        };
+
+    private:
+        mutable Sentinel header_{};
+        size_t size_{0};
+        [[no_unique_address]] KeyOf key_of_;
+        [[no_unique_address]] Compare compare_;
+    };
+
+
+    // Implementation
+    template <typename T, typename Key, typename KeyOf, typename Compare, typename Tag>
+    requires IsRbTreeElement<T, Tag>
+    RbTree<T, Key, KeyOf, Compare, Tag>::RbTree(KeyOf key_of, Compare compare)
+            : key_of_(std::move(key_of)), compare_(std::move(compare)) {
+        header_.left_ = header_.right_ = &header_;
+        // The red header is told apart from the root when an iterator moves back from end()
+        header_.is_red_ = true;
+    }
+
+    template <typename T, typename Key, typename KeyOf, typename Compare, typename Tag>
+    requires IsRbTreeElement<T, Tag>
+    RbTree<T, Key, KeyOf, Compare, Tag>::~RbTree() {
+        Clear();
+    }
+
+    template <typename T, typename Key, typename KeyOf, typename Compare, typename Tag>
+    requires IsRbTreeElement<T, Tag>
+    bool RbTree<T, Key, KeyOf, Compare, Tag>::IsEmpty() const noexcept {
+        return size_ == 0;
+    }
+
+    template <typename T, typename Key, typename KeyOf, typename Compare, typename Tag>
+    requires IsRbTreeElement<T, Tag>
+    size_t RbTree<T, Key, KeyOf, Compare, Tag>::Size() const noexcept {
+        return size_;
+    }
+
+    template <typename T, typename Key, typename KeyOf, typename Compare, typename Tag>
+    requires IsRbTreeElement<T, Tag>
+    T* RbTree<T, Key, KeyOf, Compare, Tag>::Front() const noexcept {
+        return ToTemplateType(header_.left_);
+    }
+
+    template <typename T, typename Key, typename KeyOf, typename Compare, typename Tag>
+    requires IsRbTreeElement<T, Tag>
+    T* RbTree<T, Key, KeyOf, Compare, Tag>::Back() const noexcept {
+        return ToTemplateType(header_.right_);
+    }
+
+    template <typename T, typename Key, typename KeyOf, typename Compare, typename Tag>
+    requires IsRbTreeElement<T, Tag>
+    RbTree<T, Key, KeyOf, Compare, Tag>::iterator RbTree<T, Key, KeyOf, Compare, Tag>::Insert(T& element) {
+        decltype(auto) key = key_of_(element);
+        RbTreeElementBase* parent = &header_;
+        RbTreeElementBase* current = header_.parent_;
+        bool insert_left = true;
+        while (current != nullptr) {
+            parent = current;
+            insert_left = compare_(key, KeyOfNode(current));
+            current = insert_left ? current->left_ : current->right_;
+        }
+        RbTreeElementBase* const element_as_base = ToRbTreeElementBase(element);
+        RbTreeElementBase::InsertAndRebalance(insert_left, element_as_base, parent, header_);
+        ++size_;
+        return iterator(element_as_base);
+    }
+
+    template <typename T, typename Key, typename KeyOf, typename Compare, typename Tag>
+    requires IsRbTreeElement<T, Tag>
+    std::pair<typename RbTree<T, Key, KeyOf, Compare, Tag>::iterator, bool> RbTree<T, Key, KeyOf, Compare, Tag>::InsertUnique(T& element) {
+        decltype(auto) key = key_of_(element);
+        RbTreeElementBase* parent = &header_;
+        RbTreeElementBase* current = header_.parent_;
+        bool insert_left = true;
+        while (current != nullptr) {
+            parent = current;
+            insert_left = compare_(key, KeyOfNode(current));
+            current = insert_left ? current->left_ : current->right_;
+        }
+
+        // The only candidate for an equal key is the greatest element that is not greater than the key
+        RbTreeElementBase* not_greater = parent;
+        if (insert_left) {
+            not_greater = parent == header_.left_ ? nullptr : RbTreeElementBase::Prev(parent);
+        }
+        if (not_greater != nullptr && !compare_(KeyOfNode(not_greater), key)) {
+            return {iterator(not_greater), false};
+        }
+
+        RbTreeElementBase* const element_as_base = ToRbTreeElementBase(element);
+        RbTreeElementBase::InsertAndRebalance(insert_left, element_as_base, parent, header_);
+        ++size_;
+        return {iterator(element_as_base), true};
+    }
+
+    template <typename T, typename Key, typename KeyOf, typename Compare, typename Tag>
+    requires IsRbTreeElement<T, Tag>
+    RbTree<T, Key, KeyOf, Compare, Tag>::iterator RbTree<T, Key, KeyOf, Compare, Tag>::Erase(const_iterator position) noexcept {
+        RbTreeElementBase* const element = position.current_element_;
+        iterator result = iterator(RbTreeElementBase::Next(element));
+        RbTreeElementBase::EraseAndRebalance(element, header_);
+        --size_;
+        return result;
+    }
+
+    template <typename T, typename Key, typename KeyOf, typename Compare, typename Tag>
+    requires IsRbTreeElement<T, Tag>
+    void RbTree<T, Key, KeyOf, Compare, Tag>::Erase(T& element) noexcept {
+        RbTreeElementBase::EraseAndRebalance(ToRbTreeElementBase(element), header_);
+        --size_;
+    }
+
+    template <typename T, typename Key, typename KeyOf, typename Compare, typename Tag>
+    requires IsRbTreeElement<T, Tag>
+    void RbTree<T, Key, KeyOf, Compare, Tag>::Clear() noexcept {
+        // Post-order walk that detaches every visited subtree, so no stack is needed
+        RbTreeElementBase* current = header_.parent_;
+        while (current != nullptr) {
+            if (current->left_ != nullptr) {
+                current = std::exchange(current->left_, nullptr);
+            } else if (current->right_ != nullptr) {
+                current = std::exchange(current->right_, nullptr);
+            } else {
+                RbTreeElementBase* const parent = std::exchange(current->parent_, nullptr);
+                current->is_red_ = false;
+                current = parent == &header_ ? nullptr : parent;
+            }
+        }
+        header_.parent_ = nullptr;
+        header_.left_ = header_.right_ = &header_;
+        size_ = 0;
+    }
+
+    template <typename T, typename Key, typename KeyOf, typename Compare, typename Tag>
+    requires IsRbTreeElement<T, Tag>
+    RbTree<T, Key, KeyOf, Compare, Tag>::iterator RbTree<T, Key, KeyOf, Compare, Tag>::Find(const Key& key) {
+        return iterator(FindNode(key));
+    }
+
+    template <typename T, typename Key, typename KeyOf, typename Compare, typename Tag>
+    requires IsRbTreeElement<T, Tag>
+    RbTree<T, Key, KeyOf, Compare, Tag>::const_iterator RbTree<T, Key, KeyOf, Compare, Tag>::Find(const Key& key) const {
+        return const_iterator(FindNode(key));
+    }
+
+    template <typename T, typename Key, typename KeyOf, typename Compare, typename Tag>
+    requires IsRbTreeElement<T, Tag>
+    RbTree<T, Key, KeyOf, Compare, Tag>::iterator RbTree<T, Key, KeyOf, Compare, Tag>::LowerBound(const Key& key) {
+        return iterator(LowerBoundNode(key));
+    }
+
+    template <typename T, typename Key, typename KeyOf, typename Compare, typename Tag>
+    requires IsRbTreeElement<T, Tag>
+    RbTree<T, Key, KeyOf, Compare, Tag>::const_iterator RbTree<T, Key, KeyOf, Compare, Tag>::LowerBound(const Key& key) const {
+        return const_iterator(LowerBoundNode(key));
+    }
+
+    template <typename T, typename Key, typename KeyOf, typename Compare, typename Tag>
+    requires IsRbTreeElement<T, Tag>
+    RbTree<T, Key, KeyOf, Compare, Tag>::iterator RbTree<T, Key, KeyOf, Compare, Tag>::UpperBound(const Key& key) {
+        return iterator(UpperBoundNode(key));
+    }
+
+    template <typename T, typename Key, typename KeyOf, typename Compare, typename Tag>
+    requires IsRbTreeElement<T, Tag>
+    RbTree<T, Key, KeyOf, Compare, Tag>::const_iterator RbTree<T, Key, KeyOf, Compare, Tag>::UpperBound(const Key& key) const {
+        return const_iterator(UpperBoundNode(key));
+    }
+
+    template <typename T, typename Key, typename KeyOf, typename Compare, typename Tag>
+    requires IsRbTreeElement<T, Tag>
+    RbTree<T, Key, KeyOf, Compare, Tag>::iterator RbTree<T, Key, KeyOf, Compare, Tag>::begin() {
+        return iterator(header_.left_);
+    }
+
+    template <typename T, typename Key, typename KeyOf, typename Compare, typename Tag>
+    requires IsRbTreeElement<T, Tag>
+    RbTree<T, Key, KeyOf, Compare, Tag>::iterator RbTree<T, Key, KeyOf, Compare, Tag>::end() {
+        return iterator(&header_);
+    }
+
+    template <typename T, typename Key, typename KeyOf, typename Compare, typename Tag>
+    requires IsRbTreeElement<T, Tag>
+    RbTree<T, Key, KeyOf, Compare, Tag>::const_iterator RbTree<T, Key, KeyOf, Compare, Tag>::begin() const {
+        return const_iterator(header_.left_);
+    }
+
+    template <typename T, typename Key, typename KeyOf, typename Compare, typename Tag>
+    requires IsRbTreeElement<T, Tag>
+    RbTree<T, Key, KeyOf, Compare, Tag>::const_iterator RbTree<T, Key, KeyOf, Compare, Tag>::end() const {
+        return const_iterator(Header());
+    }
+
+    template <typename T, typename Key, typename KeyOf, typename Compare, typename Tag>
+    requires IsRbTreeElement<T, Tag>
+    RbTree<T, Key, KeyOf, Compare, Tag>::const_iterator RbTree<T, Key, KeyOf, Compare, Tag>::cbegin() const {
+        return begin();
+    }
+
+    template <typename T, typename Key, typename KeyOf, typename Compare, typename Tag>
+    requires IsRbTreeElement<T, Tag>
+    RbTree<T, Key, KeyOf, Compare, Tag>::const_iterator RbTree<T, Key, KeyOf, Compare, Tag>::cend() const {
+        return end();
+    }
+
+    template <typename T, typename Key, typename KeyOf, typename Compare, typename Tag>
+    requires IsRbTreeElement<T, Tag>
+    RbTree<T, Key, KeyOf, Compare, Tag>::iterator RbTree<T, Key, KeyOf, Compare, Tag>::GetIterator(T& element) {
+        return iterator(ToRbTreeElementBase(element));
+    }
+
+    template <typename T, typename Key, typename KeyOf, typename Compare, typename Tag>
+    requires IsRbTreeElement<T, Tag>
+    RbTree<T, Key, KeyOf, Compare, Tag>::const_iterator RbTree<T, Key, KeyOf, Compare, Tag>::GetIterator(const T& element) const {
+        return const_iterator(ToRbTreeElementBase(element));
+    }
+
+    template <typename T, typename Key, typename KeyOf, typename Compare, typename Tag>
+    requires IsRbTreeElement<T, Tag>
+    RbTreeElementBase* RbTree<T, Key, KeyOf, Compare, Tag>::FindNode(const Key& key) const {
+        RbTreeElementBase* const lower_bound = LowerBoundNode(key);
+        if (lower_bound == Header() || compare_(key, KeyOfNode(lower_bound))) {
+            return Header();
+        }
+        return lower_bound;
+    }
+
+    template <typename T, typename Key, typename KeyOf, typename Compare, typename Tag>
+    requires IsRbTreeElement<T, Tag>
+    RbTreeElementBase* RbTree<T, Key, KeyOf, Compare, Tag>::LowerBoundNode(const Key& key) const {
+        RbTreeElementBase* result = Header();
+        RbTreeElementBase* current = header_.parent_;
+        while (current != nullptr) {
+            if (!compare_(KeyOfNode(current), key)) {
+                result = current;
+                current = current->left_;
+            } else {
+                current = current->right_;
+            }
+        }
+        return result;
+    }
+
+    template <typename T, typename Key, typename KeyOf, typename Compare, typename Tag>
+    requires IsRbTreeElement<T, Tag>
+    RbTreeElementBase* RbTree<T, Key, KeyOf, Compare, Tag>::UpperBoundNode(const Key& key) const {
+        RbTreeElementBase* result = Header();
+        RbTreeElementBase* current = header_.parent_;
+        while (current != nullptr) {
+            if (compare_(key, KeyOfNode(current))) {
+                result = current;
+                current = current->left_;
+            } else {
+                current = current->right_;
+            }
+        }
+        return result;
+    }
+
+    template <typename T, typename Key, typename KeyOf, typename Compare, typename Tag>
+    requires IsRbTreeElement<T, Tag>
+    decltype(auto) RbTree<T, Key, KeyOf, Compare, Tag>::KeyOfNode(RbTreeElementBase* element) const {
+        return key_of_(*ToTemplateType(element));
+    }
+
+    template <typename T, typename Key, typename KeyOf, typename Compare, typename Tag>
+    requires IsRbTreeElement<T, Tag>
+    RbTreeElementBase* RbTree<T, Key, KeyOf, Compare, Tag>::Header() const noexcept {
+        return &header_;
+    }
+
+    template <typename T, typename Key, typename KeyOf, typename Compare, typename Tag>
+    requires IsRbTreeElement<T, Tag>
+    RbTreeElementBase* RbTree<T, Key, KeyOf, Compare, Tag>::ToRbTreeElementBase(const T& element) noexcept {
+        return static_cast<RbTreeElementBase*>(static_cast<RbTreeElement<Tag>*>(const_cast<T*>(&element)));
+    }
+
+    template <typename T, typename Key, typename KeyOf, typename Compare, typename Tag>
+    requires IsRbTreeElement<T, Tag>
+    T* RbTree<T, Key, KeyOf, Compare, Tag>::ToTemplateType(RbTreeElementBase* element) noexcept {
+        return static_cast<T*>(static_cast<RbTreeElement<Tag>*>(element));
+    }
+
+
+    // Iterator
+    template <typename T, typename Key, typename KeyOf, typename Compare, typename Tag>
+    requires IsRbTreeElement<T, Tag>
+    template <bool isConstType>
+    RbTree<T, Key, KeyOf, Compare, Tag>::Iterator<isConstType>::Iterator(RbTreeElementBase* element) : current_element_(element) {}
+
+    template <typename T, typename Key, typename KeyOf, typename Compare, typename Tag>
+    requires IsRbTreeElement<T, Tag>
+    template <bool isConstType>
+    template <bool _isConstType>
+    requires isConstType
+    RbTree<T, Key, KeyOf, Compare, Tag>::Iterator<isConstType>::Iterator(const Iterator<_isConstType>& other)
+        : current_element_(other.current_element_) {}
+
+    template <typename T, typename Key, typename KeyOf, typename Compare, typename Tag>
+    requires IsRbTreeElement<T, Tag>
+    template <bool isConstType>
+    RbTree<T, Key, KeyOf, Compare, Tag>::Iterator<isConstType>& RbTree<T, Key, KeyOf, Compare, Tag>::Iterator<isConstType>::operator++() {
+        current_element_ = RbTreeElementBase::Next(current_element_);
+        return *this;
+    }
+
+    template <typename T, typename Key, typename KeyOf, typename Compare, typename Tag>
+    requires IsRbTreeElement<T, Tag>
+    template <bool isConstType>
+    RbTree<T, Key, KeyOf, Compare, Tag>::Iterator<isConstType>& RbTree<T, Key, KeyOf, Compare, Tag>::Iterator<isConstType>::operator--() {
+        current_element_ = RbTreeElementBase::Prev(current_element_);
+        return *this;
+    }
+
+    template <typename T, typename Key, typename KeyOf, typename Compare, typename Tag>
+    requires IsRbTreeElement<T, Tag>
+    template <bool isConstType>
+    RbTree<T, Key, KeyOf, Compare, Tag>::Iterator<isConstType> RbTree<T, Key, KeyOf, Compare, Tag>::Iterator<isConstType>::operator++(int) {
+        Iterator result = *this;
+        ++*this;
+        return result;
+    }
+
+    template <typename T, typename Key, typename KeyOf, typename Compare, typename Tag>
+    requires IsRbTreeElement<T, Tag>
+    template <bool isConstType>
+    RbTree<T, Key, KeyOf, Compare, Tag>::Iterator<isConstType> RbTree<T, Key, KeyOf, Compare, Tag>::Iterator<isConstType>::operator--(int) {
+        Iterator result = *this;
+        --*this;
+        return result;
+    }
+
+    template <typename T, typename Key, typename KeyOf, typename Compare, typename Tag>
+    requires IsRbTreeElement<T, Tag>
+    template <bool isConstType>
+    bool RbTree<T, Key, KeyOf, Compare, Tag>::Iterator<isConstType>::operator==(const Iterator& other) const noexcept {
+        return current_element_ == other.current_element_;
+    }
+
+    template <typename T, typename Key, typename KeyOf, typename Compare, typename Tag>
+    requires IsRbTreeElement<T, Tag>
+    template <bool isConstType>
+    bool RbTree<T, Key, KeyOf, Compare, Tag>::Iterator<isConstType>::operator!=(const Iterator& other) const noexcept {
+        return current_element_ != other.current_element_;
+    }
+
+    template <typename T, typename Key, typename KeyOf, typename Compare, typename Tag>
+    requires IsRbTreeElement<T, Tag>
+    template <bool isConstType>
+    RbTree<T, Key, KeyOf, Compare, Tag>::Iterator<isConstType>::reference RbTree<T, Key, KeyOf, Compare, Tag>::Iterator<isConstType>::operator*() const {
+        return *ToTemplateType(current_element_);
+    }
+
+    template <typename T, typename Key, typename KeyOf, typename Compare, typename Tag>
+    requires IsRbTreeElement<T, Tag>
+    template <bool isConstType>
+    RbTree<T, Key, KeyOf, Compare, Tag>::Iterator<isConstType>::pointer RbTree<T, Key, KeyOf, Compare, Tag>::Iterator<isConstType>::operator->() const {
+        return ToTemplateType(current_element_);
+    }
+
+} //End of namespace intrusive
+
+#endif //CPP_IMPLEMENTATIONS_RB_TREE_H
@@ -0,0 +1,426 @@
+#ifndef CPP_IMPLEMENTATIONS_SLIST_H
+#define CPP_IMPLEMENTATIONS_SLIST_H
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include "intrusive_list.h"
+
+namespace cpp::intrusive {
+
+    template <typename Tag = DefaultTag>
+    class SListElement;
+
+    template <typename T, typename Tag>
+    concept IsSListElement = std::is_base_of_v<SListElement<Tag>, T>;
+
+    template <typename T, typename Tag = DefaultTag, bool CacheLast = false>
+    requires IsSListElement<T, Tag>
+    class SList;
+
+
+    class SListElementBase {
+    protected:
+        SListElementBase() = default;
+        ~SListElementBase() = default;
+
+    private:
+        SListElementBase* next_{nullptr};
+
+        template <typename T, typename Tag, bool CacheLast>
+        requires IsSListElement<T, Tag>
+        friend class SList;
+
+    };
+
+    // One-pointer hook of SList and Stack. A singly linked element cannot unlink itself,
+    // so it must be removed from the list before it is destroyed.
+    template <typename Tag>
+    class SListElement : private SListElementBase {
+    protected:
+        SListElement() = default;
+        ~SListElement() = default;
+
+    public:
+        SListElement(const SListElement&) = delete;
+        SListElement(const SListElement&&) = delete;
+        SListElement& operator=(const SListElement&) = delete;
+        SListElement& operator=(const SListElement&&) = delete;
+
+        template <typename T, typename Tag_, bool CacheLast>
+        requires IsSListElement<T, Tag_>
+        friend class SList;
+
+    };
+
+
+    // Singly linked intrusive list. With CacheLast the list also stores a pointer to the last element,
+    // so PushBack and Back are O(1) and the list can be used as a FIFO queue.
+    template <typename T, typename Tag, bool CacheLast>
+    requires IsSListElement<T, Tag>
+    class SList {
+    private:
+        template <bool isConstType>
+        class Iterator;
+
+    public:
+        using iterator = Iterator<false>;
+        using const_iterator = Iterator<true>;
+
+        SList() = default;
+
+        SList(const SList&) = delete;
+        SList& operator=(const SList&) = delete;
+
+        SList(SList&& other) noexcept;
+        SList& operator=(SList&& other) noexcept;
+
+        ~SList() = default;
+
+        void Swap(SList& other) noexcept;
+
+        [[nodiscard]] bool IsEmpty() const noexcept;
+        [[nodiscard]] size_t Size() const noexcept;
+
+        T* Front() const noexcept;
+        T* Back() const noexcept requires CacheLast;
+
+        void PushFront(T& element) noexcept;
+        void PushBack(T& element) noexcept requires CacheLast;
+        void PopFront() noexcept;
+
+        // Inserts the element after position, which may be before_begin()
+        iterator InsertAfter(const_iterator position, T& element) noexcept;
+
+        // Erases the element after position and returns the iterator to the element after the erased one
+        iterator EraseAfter(const_iterator position) noexcept;
+
+        void Clear() noexcept;
+
+        iterator before_begin();
+        iterator begin();
+        iterator end();
+        const_iterator cbefore_begin() const;
+        const_iterator cbegin() const;
+        const_iterator cend() const;
+
+    private:
+        static SListElementBase* ToSListElementBase(T& element) noexcept;
+        static T* ToTemplateType(SListElementBase* slist_element_base) noexcept;
+
+        // Returns the last element, or head_ if the list is empty
+        SListElementBase* Last() noexcept;
+
+        template <bool isConstType>
+        class Iterator {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = std::conditional_t<isConstType, const T*, T*>;
+            using reference = std::conditional_t<isConstType, const T&, T&>;
+
+            Iterator() = default;
+            explicit Iterator(SListElementBase* element);
+
+            template <bool _isConstType>
+            requires isConstType
+            Iterator(const Iterator<_isConstType>& other);
+
+            Iterator& operator++();
+            Iterator operator++(int);
+
+            bool operator==(const Iterator& other) const noexcept = default;
+
+            reference operator*() const;
+            pointer operator->() const;
+
+            friend class SList;
+
+        private:
+            SListElementBase* current_element_{nullptr};
+        };
+
+        class Head : public SListElementBase {};
+
+        struct NoLast {};
+
+    private:
+        mutable Head head_{};
+        [[no_unique_address]] std::conditional_t<CacheLast, SListElementBase*, NoLast> last_{};
+    };
+
+
+    // LIFO stack over the one-pointer hook, e.g. for free lists
+    template <typename T, typename Tag = DefaultTag>
+    requires IsSListElement<T, Tag>
+    class Stack {
+    public:
+        Stack() = default;
+
+        void Push(T& element) noexcept;
+
+        // Removes and returns the top element, or returns nullptr if the stack is empty
+        T* Pop() noexcept;
+
+        T* Top() const noexcept;
+
+        [[nodiscard]] bool IsEmpty() const noexcept;
+
+    private:
+        SList<T, Tag> list_;
+    };
+
+
+    // Implementation
+    template <typename T, typename Tag, bool CacheLast>
+    requires IsSListElement<T, Tag>
+    SList<T, Tag, CacheLast>::SList(SList&& other) noexcept {
+        Swap(other);
+    }
+
+    template <typename T, typename Tag, bool CacheLast>
+    requires IsSListElement<T, Tag>
+    SList<T, Tag, CacheLast>& SList<T, Tag, CacheLast>::operator=(SList&& other) noexcept {
+        Swap(other);
+        return *this;
+    }
+
+    template <typename T, typename Tag, bool CacheLast>
+    requires IsSListElement<T, Tag>
+    void SList<T, Tag, CacheLast>::Swap(SList& other) noexcept {
+        using std::swap;
+        swap(head_.next_, other.head_.next_);
+        if constexpr (CacheLast) {
+            swap(last_, other.last_);
+        }
+    }
+
+    template <typename T, typename Tag, bool CacheLast>
+    requires IsSListElement<T, Tag>
+    bool SList<T, Tag, CacheLast>::IsEmpty() const noexcept {
+        return head_.next_ == nullptr;
+    }
+
+    template <typename T, typename Tag, bool CacheLast>
+    requires IsSListElement<T, Tag>
+    size_t SList<T, Tag, CacheLast>::Size() const noexcept {
+        size_t size = 0;
+        for (SListElementBase* element = head_.next_; element != nullptr; element = element->next_) {
+            ++size;
+        }
+        return size;
+    }
+
+    template <typename T, typename Tag, bool CacheLast>
+    requires IsSListElement<T, Tag>
+    T* SList<T, Tag, CacheLast>::Front() const noexcept {
+        return ToTemplateType(head_.next_);
+    }
+
+    template <typename T, typename Tag, bool CacheLast>
+    requires IsSListElement<T, Tag>
+    T* SList<T, Tag, CacheLast>::Back() const noexcept requires CacheLast {
+        return ToTemplateType(last_);
+    }
+
+    template <typename T, typename Tag, bool CacheLast>
+    requires IsSListElement<T, Tag>
+    void SList<T, Tag, CacheLast>::PushFront(T& element) noexcept {
+        InsertAfter(cbefore_begin(), element);
+    }
+
+    template <typename T, typename Tag, bool CacheLast>
+    requires IsSListElement<T, Tag>
+    void SList<T, Tag, CacheLast>::PushBack(T& element) noexcept requires CacheLast {
+        InsertAfter(const_iterator(Last()), element);
+    }
+
+    template <typename T, typename Tag, bool CacheLast>
+    requires IsSListElement<T, Tag>
+    void SList<T, Tag, CacheLast>::PopFront() noexcept {
+        EraseAfter(cbefore_begin());
+    }
+
+    template <typename T, typename Tag, bool CacheLast>
+    requires IsSListElement<T, Tag>
+    SList<T, Tag, CacheLast>::iterator SList<T, Tag, CacheLast>::InsertAfter(const_iterator position, T& element) noexcept {
+        SListElementBase* const position_as_base = position.current_element_;
+        SListElementBase* const element_as_base = ToSListElementBase(element);
+        element_as_base->next_ = position_as_base->next_;
+        position_as_base->next_ = element_as_base;
+        if constexpr (CacheLast) {
+            if (element_as_base->next_ == nullptr) {
+                last_ = element_as_base;
+            }
+        }
+        return iterator(element_as_base);
+    }
+
+    template <typename T, typename Tag, bool CacheLast>
+    requires IsSListElement<T, Tag>
+    SList<T, Tag, CacheLast>::iterator SList<T, Tag, CacheLast>::EraseAfter(const_iterator position) noexcept {
+        SListElementBase* const position_as_base = position.current_element_;
+        SListElementBase* const erased = position_as_base->next_;
+        position_as_base->next_ = erased->next_;
+        if constexpr (CacheLast) {
+            if (position_as_base->next_ == nullptr) {
+                last_ = position_as_base == &head_ ? nullptr : position_as_base;
+            }
+        }
+        return iterator(position_as_base->next_);
+    }
+
+    template <typename T, typename Tag, bool CacheLast>
+    requires IsSListElement<T, Tag>
+    void SList<T, Tag, CacheLast>::Clear() noexcept {
+        head_.next_ = nullptr;
+        if constexpr (CacheLast) {
+            last_ = nullptr;
+        }
+    }
+
+    template <typename T, typename Tag, bool CacheLast>
+    requires IsSListElement<T, Tag>
+    SListElementBase* SList<T, Tag, CacheLast>::ToSListElementBase(T& element) noexcept {
+        return static_cast<SListElementBase*>(static_cast<SListElement<Tag>*>(&element));
+    }
+
+    template <typename T, typename Tag, bool CacheLast>
+    requires IsSListElement<T, Tag>
+    T* SList<T, Tag, CacheLast>::ToTemplateType(SListElementBase* slist_element_base) noexcept {
+        return static_cast<T*>(static_cast<SListElement<Tag>*>(slist_element_base));
+    }
+
+    template <typename T, typename Tag, bool CacheLast>
+    requires IsSListElement<T, Tag>
+    SListElementBase* SList<T, Tag, CacheLast>::Last() noexcept {
+        if constexpr (CacheLast) {
+            return last_ == nullptr ? &head_ : last_;
+        } else {
+            SListElementBase* last = &head_;
+            while (last->next_ != nullptr) {
+                last = last->next_;
+            }
+            return last;
+        }
+    }
+
+
+    // Iterators
+    template <typename T, typename Tag, bool CacheLast>
+    requires IsSListElement<T, Tag>
+    SList<T, Tag, CacheLast>::iterator SList<T, Tag, CacheLast>::before_begin() {
+        return iterator(&head_);
+    }
+
+    template <typename T, typename Tag, bool CacheLast>
+    requires IsSListElement<T, Tag>
+    SList<T, Tag, CacheLast>::iterator SList<T, Tag, CacheLast>::begin() {
+        return iterator(head_.next_);
+    }
+
+    template <typename T, typename Tag, bool CacheLast>
+    requires IsSListElement<T, Tag>
+    SList<T, Tag, CacheLast>::iterator SList<T, Tag, CacheLast>::end() {
+        return iterator(nullptr);
+    }
+
+    template <typename T, typename Tag, bool CacheLast>
+    requires IsSListElement<T, Tag>
+    SList<T, Tag, CacheLast>::const_iterator SList<T, Tag, CacheLast>::cbefore_begin() const {
+        return const_iterator(&head_);
+    }
+
+    template <typename T, typename Tag, bool CacheLast>
+    requires IsSListElement<T, Tag>
+    SList<T, Tag, CacheLast>::const_iterator SList<T, Tag, CacheLast>::cbegin() const {
+        return const_iterator(head_.next_);
+    }
+
+    template <typename T, typename Tag, bool CacheLast>
+    requires IsSListElement<T, Tag>
+    SList<T, Tag, CacheLast>::const_iterator SList<T, Tag, CacheLast>::cend() const {
+        return const_iterator(nullptr);
+    }
+
+
+    // Iterator
+    template <typename T, typename Tag, bool CacheLast>
+    requires IsSListElement<T, Tag>
+    template <bool isConstType>
+    SList<T, Tag, CacheLast>::Iterator<isConstType>::Iterator(SListElementBase* element) : current_element_(element) {}
+
+    template <typename T, typename Tag, bool CacheLast>
+    requires IsSListElement<T, Tag>
+    template <bool isConstType>
+    template <bool _isConstType>
+    requires isConstType
+    SList<T, Tag, CacheLast>::Iterator<isConstType>::Iterator(const Iterator<_isConstType>& other)
+        : current_element_(other.current_element_) {}
+
+    template <typename T, typename Tag, bool CacheLast>
+    requires IsSListElement<T, Tag>
+    template <bool isConstType>
+    SList<T, Tag, CacheLast>::Iterator<isConstType>& SList<T, Tag, CacheLast>::Iterator<isConstType>::operator++() {
+        current_element_ = current_element_->next_;
+        return *this;
+    }
+
+    template <typename T, typename Tag, bool CacheLast>
+    requires IsSListElement<T, Tag>
+    template <bool isConstType>
+    SList<T, Tag, CacheLast>::Iterator<isConstType> SList<T, Tag, CacheLast>::Iterator<isConstType>::operator++(int) {
+        Iterator result = *this;
+        current_element_ = current_element_->next_;
+        return result;
+    }
+
+    template <typename T, typename Tag, bool CacheLast>
+    requires IsSListElement<T, Tag>
+    template <bool isConstType>
+    SList<T, Tag, CacheLast>::Iterator<isConstType>::reference SList<T, Tag, CacheLast>::Iterator<isConstType>::operator*() const {
+        return *ToTemplateType(current_element_);
+    }
+
+    template <typename T, typename Tag, bool CacheLast>
+    requires IsSListElement<T, Tag>
+    template <bool isConstType>
+    SList<T, Tag, CacheLast>::Iterator<isConstType>::pointer SList<T, Tag, CacheLast>::Iterator<isConstType>::operator->() const {
+        return ToTemplateType(current_element_);
+    }
+
+
+    // Stack
+    template <typename T, typename Tag>
+    requires IsSListElement<T, Tag>
+    void Stack<T, Tag>::Push(T& element) noexcept {
+        list_.PushFront(element);
+    }
+
+    template <typename T, typename Tag>
+    requires IsSListElement<T, Tag>
+    T* Stack<T, Tag>::Pop() noexcept {
+        if (list_.IsEmpty()) {
+            return nullptr;
+        }
+        T* const top = list_.Front();
+        list_.PopFront();
+        return top;
+    }
+
+    template <typename T, typename Tag>
+    requires IsSListElement<T, Tag>
+    T* Stack<T, Tag>::Top() const noexcept {
+        return list_.IsEmpty() ? nullptr : list_.Front();
+    }
+
+    template <typename T, typename Tag>
+    requires IsSListElement<T, Tag>
+    bool Stack<T, Tag>::IsEmpty() const noexcept {
+        return list_.IsEmpty();
+    }
+
+} //End of namespace intrusive
+
+#endif //CPP_IMPLEMENTATIONS_SLIST_H
@@ -0,0 +1,284 @@
+#ifndef CPP_IMPLEMENTATIONS_TIMER_WHEEL_H
+#define CPP_IMPLEMENTATIONS_TIMER_WHEEL_H
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include "intrusive_list.h"
+
+namespace cpp::intrusive {
+
+    template <typename Tag = DefaultTag>
+    class TimerElement;
+
+    template <typename T, typename Tag>
+    concept IsTimerElement = std::is_base_of_v<TimerElement<Tag>, T> && IsListElement<T, Tag>;
+
+    template <typename T, typename Tag = DefaultTag>
+    requires IsTimerElement<T, Tag>
+    class TimerWheel;
+
+
+    // Hook of the timer wheel: the timer is linked into a slot of the wheel through ListElement<Tag>
+    // and remembers its deadline and slot, so it can be cancelled in O(1).
+    template <typename Tag>
+    class TimerElement : public ListElement<Tag> {
+    protected:
+        TimerElement() = default;
+        ~TimerElement() = default;
+
+    public:
+        [[nodiscard]] uint64_t Deadline() const noexcept {
+            return deadline_;
+        }
+
+        [[nodiscard]] bool IsScheduled() const noexcept {
+            return slot_ != kNotScheduled;
+        }
+
+    private:
+        static constexpr uint32_t kNotScheduled = std::numeric_limits<uint32_t>::max();
+
+        uint64_t deadline_{0};
+        uint32_t slot_{kNotScheduled};
+
+        template <typename T, typename Tag_>
+        requires IsTimerElement<T, Tag_>
+        friend class TimerWheel;
+
+    };
+
+
+    // Hierarchical timing wheel. Time is measured in ticks.
+    // Level 0 has a slot for each of the next 256 ticks, every next level covers 256 times longer intervals.
+    // Schedule and Cancel are O(1), a tick moves the timers of a single slot of the upper levels one level down.
+    // The wheel does not own the timers: a scheduled timer must be cancelled before it is destroyed.
+    template <typename T, typename Tag>
+    requires IsTimerElement<T, Tag>
+    class TimerWheel {
+    public:
+        static constexpr size_t kSlotBits = 8;
+        static constexpr size_t kSlotsCount = size_t{1} << kSlotBits;
+        static constexpr size_t kLevelsCount = 4;
+
+        explicit TimerWheel(uint64_t now = 0) noexcept;
+
+        TimerWheel(const TimerWheel&) = delete;
+        TimerWheel(TimerWheel&&) = delete;
+        TimerWheel& operator=(const TimerWheel&) = delete;
+        TimerWheel& operator=(TimerWheel&&) = delete;
+
+        ~TimerWheel() = default;
+
+        // Schedules the timer to expire at the deadline tick. A scheduled timer is rescheduled.
+        // A deadline that is not in the future expires on the next tick.
+        void Schedule(T& timer, uint64_t deadline);
+
+        void Cancel(T& timer);
+
+        // Moves the time forward and calls on_expire(T&) for every timer with the deadline not after now.
+        // The timer is unscheduled before the call, so it may be scheduled again. Returns the number of expired timers.
+        template <typename F>
+        size_t Advance(uint64_t now, F&& on_expire);
+
+        [[nodiscard]] uint64_t Now() const noexcept;
+        [[nodiscard]] size_t Size() const noexcept;
+        [[nodiscard]] bool IsEmpty() const noexcept;
+
+    private:
+        using Slot = List<T, Tag>;
+
+        void Place(T& timer);
+        void Cascade(size_t level);
+
+        // Returns the next tick that expires or cascades timers
+        [[nodiscard]] uint64_t NextEventTick() const noexcept;
+
+        // Returns the first non-empty slot of level 0 after index, or kSlotsCount if there is none
+        [[nodiscard]] size_t NextOccupiedSlot(size_t index) const noexcept;
+
+        static TimerElement<Tag>& ToTimerElement(T& timer) noexcept;
+
+    private:
+        std::array<std::array<Slot, kSlotsCount>, kLevelsCount> slots_{};
+        std::array<size_t, kLevelsCount> level_sizes_{};
+        // Bitmap of the non-empty slots of level 0
+        std::array<uint64_t, kSlotsCount / 64> occupied_slots_{};
+        uint64_t now_;
+        size_t size_{0};
+    };
+
+
+    // Implementation
+    template <typename T, typename Tag>
+    requires IsTimerElement<T, Tag>
+    TimerWheel<T, Tag>::TimerWheel(uint64_t now) noexcept : now_(now) {}
+
+    template <typename T, typename Tag>
+    requires IsTimerElement<T, Tag>
+    void TimerWheel<T, Tag>::Schedule(T& timer, uint64_t deadline) {
+        Cancel(timer);
+        ToTimerElement(timer).deadline_ = std::max(deadline, now_ + 1);
+        Place(timer);
+        ++size_;
+    }
+
+    template <typename T, typename Tag>
+    requires IsTimerElement<T, Tag>
+    void TimerWheel<T, Tag>::Cancel(T& timer) {
+        TimerElement<Tag>& element = ToTimerElement(timer);
+        if (!element.IsScheduled()) {
+            return;
+        }
+        Slot& slot = slots_[element.slot_ / kSlotsCount][element.slot_ % kSlotsCount];
+        slot.Erase(slot.GetIterator(timer));
+        --level_sizes_[element.slot_ / kSlotsCount];
+        if (element.slot_ < kSlotsCount && slot.IsEmpty()) {
+            occupied_slots_[element.slot_ / 64] &= ~(uint64_t{1} << (element.slot_ % 64));
+        }
+        element.slot_ = TimerElement<Tag>::kNotScheduled;
+        --size_;
+    }
+
+    template <typename T, typename Tag>
+    requires IsTimerElement<T, Tag>
+    template <typename F>
+    size_t TimerWheel<T, Tag>::Advance(uint64_t now, F&& on_expire) {
+        size_t expired_count = 0;
+        while (now_ < now) {
+            const uint64_t next_tick = NextEventTick();
+            if (next_tick > now) {
+                now_ = now;
+                break;
+            }
+            now_ = next_tick;
+
+            size_t levels_to_cascade = 0;
+            while (levels_to_cascade + 1 < kLevelsCount && (now_ & ((uint64_t{1} << (kSlotBits * (levels_to_cascade + 1))) - 1)) == 0) {
+                ++levels_to_cascade;
+            }
+            for (size_t level = levels_to_cascade; level > 0; level--) {
+                Cascade(level);
+            }
+
+            const size_t slot = now_ % kSlotsCount;
+            Slot expired;
+            expired.Splice(expired.cend(), slots_[0][slot]);
+            occupied_slots_[slot / 64] &= ~(uint64_t{1} << (slot % 64));
+            while (!expired.IsEmpty()) {
+                T& timer = *expired.Front();
+                expired.PopFront();
+                --level_sizes_[0];
+                ToTimerElement(timer).slot_ = TimerElement<Tag>::kNotScheduled;
+                --size_;
+                ++expired_count;
+                on_expire(timer);
+            }
+        }
+        return expired_count;
+    }
+
+    template <typename T, typename Tag>
+    requires IsTimerElement<T, Tag>
+    uint64_t TimerWheel<T, Tag>::Now() const noexcept {
+        return now_;
+    }
+
+    template <typename T, typename Tag>
+    requires IsTimerElement<T, Tag>
+    size_t TimerWheel<T, Tag>::Size() const noexcept {
+        return size_;
+    }
+
+    template <typename T, typename Tag>
+    requires IsTimerElement<T, Tag>
+    bool TimerWheel<T, Tag>::IsEmpty() const noexcept {
+        return size_ == 0;
+    }
+
+    template <typename T, typename Tag>
+    requires IsTimerElement<T, Tag>
+    void TimerWheel<T, Tag>::Place(T& timer) {
+        TimerElement<Tag>& element = ToTimerElement(timer);
+        constexpr uint64_t kMaxDelta = (uint64_t{1} << (kSlotBits * kLevelsCount)) - 1;
+        // Timers beyond the range of the wheel wait in the top level and are placed again when it cascades
+        const uint64_t deadline = std::min(element.deadline_, now_ + kMaxDelta);
+        const uint64_t delta = deadline - now_;
+
+        size_t level = 0;
+        while (level + 1 < kLevelsCount && delta >= (uint64_t{1} << (kSlotBits * (level + 1)))) {
+            ++level;
+        }
+        const size_t slot = (deadline >> (kSlotBits * level)) % kSlotsCount;
+        element.slot_ = static_cast<uint32_t>(level * kSlotsCount + slot);
+        slots_[level][slot].PushBack(timer);
+        ++level_sizes_[level];
+        if (level == 0) {
+            occupied_slots_[slot / 64] |= uint64_t{1} << (slot % 64);
+        }
+    }
+
+    template <typename T, typename Tag>
+    requires IsTimerElement<T, Tag>
+    void TimerWheel<T, Tag>::Cascade(size_t level) {
+        Slot cascaded;
+        cascaded.Splice(cascaded.cend(), slots_[level][(now_ >> (kSlotBits * level)) % kSlotsCount]);
+        while (!cascaded.IsEmpty()) {
+            T& timer = *cascaded.Front();
+            cascaded.PopFront();
+            --level_sizes_[level];
+            Place(timer);
+        }
+    }
+
+    template <typename T, typename Tag>
+    requires IsTimerElement<T, Tag>
+    uint64_t TimerWheel<T, Tag>::NextEventTick() const noexcept {
+        if (size_ == 0) {
+            return std::numeric_limits<uint64_t>::max();
+        }
+        size_t lowest_level = 0;
+        while (level_sizes_[lowest_level] == 0) {
+            ++lowest_level;
+        }
+        if (lowest_level == 0) {
+            const size_t index = now_ % kSlotsCount;
+            const size_t next_slot = NextOccupiedSlot(index);
+            if (next_slot != kSlotsCount) {
+                return now_ - index + next_slot;
+            }
+            lowest_level = 1;
+        }
+        // The lower levels are empty, so nothing happens until the next cascade of the lowest level with timers
+        return (now_ | ((uint64_t{1} << (kSlotBits * lowest_level)) - 1)) + 1;
+    }
+
+    template <typename T, typename Tag>
+    requires IsTimerElement<T, Tag>
+    size_t TimerWheel<T, Tag>::NextOccupiedSlot(size_t index) const noexcept {
+        const size_t first = index + 1;
+        for (size_t word = first / 64; word < occupied_slots_.size(); word++) {
+            uint64_t bits = occupied_slots_[word];
+            if (word == first / 64) {
+                bits &= ~uint64_t{0} << (first % 64);
+            }
+            if (bits != 0) {
+                return word * 64 + static_cast<size_t>(std::countr_zero(bits));
+            }
+        }
+        return kSlotsCount;
+    }
+
+    template <typename T, typename Tag>
+    requires IsTimerElement<T, Tag>
+    TimerElement<Tag>& TimerWheel<T, Tag>::ToTimerElement(T& timer) noexcept {
+        return static_cast<TimerElement<Tag>&>(timer);
+    }
+
+} //End of namespace intrusive
+
+#endif //CPP_IMPLEMENTATIONS_TIMER_WHEEL_H
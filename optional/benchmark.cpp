@@ -0,0 +1,250 @@
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+#include "optional.h"
+#include "optional_serialization.h"
+
+namespace {
+
+    constexpr size_t kKeysCount = 4'000'000;
+    constexpr size_t kLookupsCount = 10'000'000;
+
+    template <typename F>
+    void Measure(const char* name, size_t operations_count, F&& function) {
+        const auto start = std::chrono::steady_clock::now();
+        function();
+        const auto finish = std::chrono::steady_clock::now();
+        const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(finish - start).count();
+        std::cout << name << ": " << static_cast<double>(elapsed) / static_cast<double>(operations_count) << " ns/operation" << std::endl;
+    }
+
+    struct Node {
+        uint64_t key_;
+        uint64_t value_;
+    };
+
+}
+
+// The table stores the addresses of nodes, which are never null
+template <>
+struct cpp::NicheTraits<Node*> : cpp::NonNullNicheTraits<Node> {};
+
+namespace {
+
+    // A pointer without niches, so Optional keeps a separate flag as it did before the niche layout
+    struct PlainPointer {
+        Node* node_;
+
+        Node& operator*() const noexcept {
+            return *node_;
+        }
+
+        Node* operator->() const noexcept {
+            return node_;
+        }
+    };
+
+    // Open addressing with linear probing, empty slots are empty optionals
+    template <typename Pointer>
+    class HashTable {
+    public:
+        explicit HashTable(size_t capacity) : slots_(capacity) {}
+
+        void Insert(Pointer node) {
+            size_t slot = Slot(node->key_);
+            while (slots_[slot]) {
+                slot = (slot + 1) % slots_.size();
+            }
+            slots_[slot] = node;
+        }
+
+        [[nodiscard]] const Node* Find(uint64_t key) const {
+            for (size_t slot = Slot(key); slots_[slot]; slot = (slot + 1) % slots_.size()) {
+                const Pointer& node = *slots_[slot];
+                if (node->key_ == key) {
+                    return &*node;
+                }
+            }
+            return nullptr;
+        }
+
+        [[nodiscard]] size_t MemoryUsage() const noexcept {
+            return slots_.size() * sizeof(cpp::optional::Optional<Pointer>);
+        }
+
+    private:
+        [[nodiscard]] size_t Slot(uint64_t key) const noexcept {
+            return (key * 0x9E3779B97F4A7C15ull) % slots_.size();
+        }
+
+        std::vector<cpp::optional::Optional<Pointer>> slots_;
+    };
+
+    template <typename Pointer>
+    void BenchmarkHashTable(const char* name, const std::vector<Node>& nodes, const std::vector<uint64_t>& lookups) {
+        HashTable<Pointer> table(kKeysCount * 2);
+        for (const auto& node : nodes) {
+            table.Insert(Pointer{const_cast<Node*>(&node)});
+        }
+        std::cout << name << ", sizeof(Optional): " << sizeof(cpp::optional::Optional<Pointer>) << ", table: "
+                  << table.MemoryUsage() / (1024 * 1024) << " MiB" << std::endl;
+
+        uint64_t sum = 0;
+        Measure(name, kLookupsCount, [&] {
+            for (const uint64_t key : lookups) {
+                if (const Node* node = table.Find(key)) {
+                    sum += node->value_;
+                }
+            }
+        });
+        std::cout << "Sum: " << sum << std::endl;
+    }
+
+    void BenchmarkNiche() {
+        std::mt19937_64 generator{42};
+        std::vector<Node> nodes(kKeysCount);
+        for (size_t i = 0; i < kKeysCount; i++) {
+            nodes[i] = {generator(), i};
+        }
+        std::vector<uint64_t> lookups(kLookupsCount);
+        for (auto& key : lookups) {
+            // Half of the lookups miss
+            key = generator() % 2 == 0 ? nodes[generator() % kKeysCount].key_ : generator();
+        }
+
+        BenchmarkHashTable<PlainPointer>("Optional with a flag", nodes, lookups);
+        BenchmarkHashTable<Node*>("Optional<Node*> with a niche", nodes, lookups);
+    }
+
+
+    constexpr size_t kReadingsCount = 10'000'000;
+
+    // The throughput is counted in the bytes of the optionals in memory, so the encodings of different sizes are comparable
+    template <typename F>
+    void MeasureThroughput(const char* name, size_t bytes_count, F&& function) {
+        const auto start = std::chrono::steady_clock::now();
+        function();
+        const auto finish = std::chrono::steady_clock::now();
+        const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(finish - start).count();
+        std::cout << name << ": " << static_cast<double>(bytes_count) / static_cast<double>(elapsed) << " GB/s" << std::endl;
+    }
+
+    struct Reading {
+        uint64_t timestamp_;
+        double value_;
+        uint32_t sensor_;
+    };
+
+    using OptionalReading = cpp::optional::Optional<Reading>;
+
+    // Serializer written by hand: the flag and every field are appended and read back separately
+    namespace naive {
+
+        template <typename T>
+        void WriteField(std::vector<std::byte>& buffer, const T& field) {
+            const auto* bytes = reinterpret_cast<const std::byte*>(&field);
+            buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+        }
+
+        template <typename T>
+        T ReadField(const std::vector<std::byte>& buffer, size_t& offset) {
+            T field;
+            std::memcpy(&field, buffer.data() + offset, sizeof(T));
+            offset += sizeof(T);
+            return field;
+        }
+
+        void Write(std::vector<std::byte>& buffer, const OptionalReading& reading) {
+            WriteField(buffer, static_cast<bool>(reading));
+            if (reading) {
+                WriteField(buffer, reading->timestamp_);
+                WriteField(buffer, reading->value_);
+                WriteField(buffer, reading->sensor_);
+            }
+        }
+
+        OptionalReading Read(const std::vector<std::byte>& buffer, size_t& offset) {
+            if (!ReadField<bool>(buffer, offset)) {
+                return cpp::optional::nullopt;
+            }
+            Reading reading{};
+            reading.timestamp_ = ReadField<uint64_t>(buffer, offset);
+            reading.value_ = ReadField<double>(buffer, offset);
+            reading.sensor_ = ReadField<uint32_t>(buffer, offset);
+            return reading;
+        }
+
+    } // End of namespace naive
+
+    void BenchmarkSerialization() {
+        std::mt19937_64 generator{42};
+        std::vector<OptionalReading> readings;
+        readings.reserve(kReadingsCount);
+        for (size_t i = 0; i < kReadingsCount; i++) {
+            // A third of the readings are missing
+            if (generator() % 3 == 0) {
+                readings.emplace_back();
+            } else {
+                readings.emplace_back(Reading{i, static_cast<double>(generator() % 1'000) / 10, static_cast<uint32_t>(generator() % 64)});
+            }
+        }
+        const size_t bytes_count = kReadingsCount * sizeof(OptionalReading);
+
+        std::vector<std::byte> naive_buffer;
+        naive_buffer.reserve(bytes_count);
+        MeasureThroughput("Naive serializer, encode", bytes_count, [&] {
+            for (const auto& reading : readings) {
+                naive::Write(naive_buffer, reading);
+            }
+        });
+
+        std::vector<std::byte> buffer;
+        buffer.reserve(bytes_count);
+        MeasureThroughput("Serialize, encode", bytes_count, [&] {
+            for (const auto& reading : readings) {
+                cpp::Serialize(reading, buffer);
+            }
+        });
+        std::cout << "Encoded size: " << naive_buffer.size() / (1 << 20) << " MiB naive, "
+                  << buffer.size() / (1 << 20) << " MiB Serialize" << std::endl;
+
+        double naive_sum = 0;
+        MeasureThroughput("Naive serializer, decode", bytes_count, [&] {
+            for (size_t offset = 0; offset < naive_buffer.size();) {
+                if (const auto reading = naive::Read(naive_buffer, offset)) {
+                    naive_sum += reading->value_;
+                }
+            }
+        });
+
+        double sum = 0;
+        MeasureThroughput("EncodedReader, decode", bytes_count, [&] {
+            for (cpp::EncodedReader<OptionalReading> reader(buffer); !reader.IsEmpty();) {
+                if (const auto reading = reader.Next().Decode()) {
+                    sum += reading->value_;
+                }
+            }
+        });
+
+        double view_sum = 0;
+        MeasureThroughput("EncodedReader, view without decoding", bytes_count, [&] {
+            for (cpp::EncodedReader<OptionalReading> reader(buffer); !reader.IsEmpty();) {
+                if (const auto reading = reader.Next()) {
+                    view_sum += (*reading).value_;
+                }
+            }
+        });
+        std::cout << "Sum: " << naive_sum << " " << sum << " " << view_sum << std::endl;
+    }
+
+} // End of namespace
+
+int main() {
+    BenchmarkNiche();
+    BenchmarkSerialization();
+    return 0;
+}
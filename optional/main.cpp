@@ -1,6 +1,26 @@
 #include <iostream>
 #include <cassert>
+#include <array>
+#include <cstdint>
 #include "optional.h"
+#include "optional_serialization.h"
+
+enum class Color : uint8_t {
+    kRed,
+    kGreen,
+    kBlue,
+};
+
+template <>
+struct cpp::NicheTraits<Color> : cpp::EnumNicheTraits<Color, Color(3)> {};
+
+struct Widget {
+    int value_;
+};
+
+// Optionals of Widget* never hold the null pointer
+template <>
+struct cpp::NicheTraits<Widget*> : cpp::NonNullNicheTraits<Widget> {};
 
 namespace {
 
@@ -55,6 +75,34 @@ namespace {
     }
 
 
+    constexpr bool NicheEnum() {
+        cpp::optional::Optional<Color> opt{};
+        bool first_assert = !opt;
+        opt = Color::kBlue;
+        return first_assert && opt && *opt == Color::kBlue;
+    }
+
+    // Empty optionals of types with niches are stored as a niche value, the other types keep a flag
+    static_assert(sizeof(cpp::optional::Optional<Widget*>) == sizeof(Widget*));
+    static_assert(sizeof(cpp::optional::Optional<Color>) == sizeof(Color));
+    static_assert(sizeof(cpp::optional::Optional<int*>) > sizeof(int*));
+
+    void AssertNichePointer() {
+        Widget widget{5};
+        cpp::optional::Optional<Widget*> opt{};
+        assert(!opt);
+        opt = &widget;
+        assert(opt && (*opt)->value_ == 5);
+        opt.Reset();
+        assert(!opt);
+
+        // Pointers without niches hold the null pointer as a value
+        cpp::optional::Optional<int*> plain{};
+        plain = nullptr;
+        assert(plain && *plain == nullptr);
+    }
+
+
     class NonCopyableClass {
         NonCopyableClass() = default;
         NonCopyableClass(const NonCopyableClass&) = delete;
@@ -88,6 +136,22 @@ namespace {
         assert(!std::is_move_assignable_v<OptionalNonCopyClass>);
     }
 
+    void AssertSerialization() {
+        using Nested = cpp::optional::Optional<cpp::optional::Optional<int>>;
+        std::vector<std::byte> buffer;
+        cpp::Serialize(Nested{cpp::optional::Optional<int>{5}}, buffer);
+        cpp::Serialize(Nested{cpp::optional::Optional<int>{}}, buffer);
+        assert(buffer.size() == 2 + sizeof(int) + 2);
+
+        cpp::EncodedReader<Nested> reader(buffer);
+        [[maybe_unused]] const auto first = reader.Next();
+        assert(first && *first && **first == 5);
+        [[maybe_unused]] const auto second = reader.Next();
+        assert(second && !*second);
+        assert(reader.IsEmpty());
+        assert(**first.Decode() == 5);
+    }
+
 }
 
 int main() {
@@ -100,7 +164,10 @@ int main() {
     static_assert(IsFive());
     static_assert(AssertReferenceOperator());
     static_assert(AssertSwap());
+    static_assert(NicheEnum());
 
     AssertCopyMoveSemantic();
+    AssertNichePointer();
+    AssertSerialization();
     return 0;
 }
@@ -3,7 +3,9 @@
 
 #include <utility>
 #include <algorithm>
+#include <cstddef>
 #include <type_traits>
+#include "common/niche_traits.h"
 
 namespace cpp::optional {
 
@@ -15,6 +17,9 @@ namespace cpp::optional {
 
     namespace details {
 
+        template <typename T>
+        inline constexpr bool kHasNiche = NicheTraits<T>::kNicheCount > 0 && std::is_trivially_copyable_v<T>;
+
         struct Dummy {};
         constexpr Dummy dummy{};
 
@@ -52,6 +57,18 @@ namespace cpp::optional {
                 }
             }
 
+            constexpr bool HasValue() const noexcept {
+                return is_present_;
+            }
+
+            constexpr T& Value() noexcept {
+                return optional_value_.value_;
+            }
+
+            constexpr const T& Value() const noexcept {
+                return optional_value_.value_;
+            }
+
         protected:
             bool is_present_;
             OptionalValue<T> optional_value_;
@@ -69,12 +86,24 @@ namespace cpp::optional {
             constexpr explicit Base(in_place_t, Args&&... args)
                     : is_present_(true), optional_value_(std::forward<Args>(args)...) {}
 
-            constexpr ~Base() {};
+            constexpr ~Base() = default;
 
             constexpr void Reset() noexcept {
                 is_present_ = false;
             }
 
+            constexpr bool HasValue() const noexcept {
+                return is_present_;
+            }
+
+            constexpr T& Value() noexcept {
+                return optional_value_.value_;
+            }
+
+            constexpr const T& Value() const noexcept {
+                return optional_value_.value_;
+            }
+
         protected:
             bool is_present_;
             OptionalValue<T> optional_value_;
@@ -144,6 +173,43 @@ namespace cpp::optional {
             using Base::optional_value_;
         };
 
+        // The empty state is the first niche of T
+        template <typename T>
+        class NicheBase {
+        public:
+            using Traits = NicheTraits<T>;
+
+            constexpr NicheBase() noexcept : value_(Traits::MakeNiche(0)) {}
+            constexpr NicheBase(nullopt_t) noexcept : value_(Traits::MakeNiche(0)) {}
+            constexpr NicheBase(const T& value) : value_(value) {}
+            constexpr NicheBase(T&& value) : value_(std::move(value)) {}
+
+            template <typename... Args>
+            constexpr explicit NicheBase(in_place_t, Args&&... args) : value_(std::forward<Args>(args)...) {}
+
+            constexpr void Reset() noexcept {
+                value_ = Traits::MakeNiche(0);
+            }
+
+            constexpr bool HasValue() const noexcept {
+                return Traits::NicheIndex(value_) == Traits::kNicheCount;
+            }
+
+            constexpr T& Value() noexcept {
+                return value_;
+            }
+
+            constexpr const T& Value() const noexcept {
+                return value_;
+            }
+
+        protected:
+            T value_;
+        };
+
+        template <typename T>
+        using OptionalBase = std::conditional_t<kHasNiche<T>, NicheBase<T>, CopyMoveBase<T, std::is_trivially_copyable_v<T>>>;
+
         template <bool Enable>
         struct EnableCopyCtor {};
 
@@ -195,13 +261,13 @@ namespace cpp::optional {
     }
 
     template <typename T>
-    class Optional final : private details::CopyMoveBase<T, std::is_trivially_copyable_v<T>>,
+    class Optional final : private details::OptionalBase<T>,
                            details::EnableCopyCtor<std::is_copy_constructible_v<T>>,
                            details::EnableMoveCtor<std::is_move_constructible_v<T>>,
                            details::EnableCopyAssign<std::is_copy_assignable_v<T>>,
                            details::EnableMoveAssign<std::is_move_assignable_v<T>> {
     private:
-        using Base = details::CopyMoveBase<T, std::is_trivially_copyable_v<T>>;
+        using Base = details::OptionalBase<T>;
         using Base::Base;
 
     public:
@@ -260,51 +326,60 @@ namespace cpp::optional {
     template <typename T>
     constexpr void Optional<T>::Swap(Optional<T>& other) {
         using std::swap;
-        swap(this->optional_value_, other.optional_value_);
-        swap(this->is_present_, other.is_present_);
+        if constexpr (details::kHasNiche<T>) {
+            swap(this->value_, other.value_);
+        } else {
+            swap(this->optional_value_, other.optional_value_);
+            swap(this->is_present_, other.is_present_);
+        }
     }
 
     template <typename T>
     template <typename... Args>
     T& Optional<T>::Emplace(Args&&... args) {
         Reset();
-        new (&(this->optional_value_.value_)) T(std::forward<Args>(args)...);
-        this->is_present_ = true;
+        if constexpr (details::kHasNiche<T>) {
+            this->value_ = T(std::forward<Args>(args)...);
+        } else {
+            new (&(this->optional_value_.value_)) T(std::forward<Args>(args)...);
+            this->is_present_ = true;
+        }
+        return this->Value();
     }
 
     template <typename T>
     constexpr T* Optional<T>::operator->() {
-        return &(this->optional_value_.value_);
+        return &(this->Value());
     }
 
     template <typename T>
     constexpr const T*  Optional<T>::operator->() const {
-        return &(this->optional_value_.value_);
+        return &(this->Value());
     }
 
     template <typename T>
     constexpr T& Optional<T>::operator*() {
-        return this->optional_value_.value_;
+        return this->Value();
     }
 
     template <typename T>
     constexpr const T& Optional<T>::operator*() const {
-        return this->optional_value_.value_;
+        return this->Value();
     }
 
     template <typename T>
     constexpr Optional<T>::operator bool() const {
-        return this->is_present_;
+        return this->HasValue();
     }
 
     template <typename T, typename U>
     constexpr bool operator==(const Optional<T>& a, const Optional<U>& b) {
-        return (a && b) ? *a == *b : a.is_present_ == b.is_present_;
+        return (a && b) ? *a == *b : bool(a) == bool(b);
     }
 
     template <typename T, typename U>
     constexpr bool operator!=(const Optional<T>& a, const Optional<U>& b) {
-        return (a && b) ? *a != *b : a.is_present != b.is_present_;
+        return (a && b) ? *a != *b : bool(a) != bool(b);
     }
 
     template <typename T, typename U>
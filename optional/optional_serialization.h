@@ -0,0 +1,83 @@
+#ifndef CPP_IMPLEMENTATIONS_OPTIONAL_SERIALIZATION_H
+#define CPP_IMPLEMENTATIONS_OPTIONAL_SERIALIZATION_H
+
+#include <cstddef>
+#include "common/encoding.h"
+#include "optional.h"
+
+namespace cpp::optional {
+
+    // Encoded optional read in place. The value is copied out of the data only when it is accessed,
+    // and a nested optional is accessed as EncodedOptional too.
+    template <typename T>
+    class EncodedOptional {
+    public:
+        // The data must hold a checked encoding, as the values returned by EncodedReader
+        explicit EncodedOptional(const std::byte* data) noexcept : data_(data) {}
+
+        [[nodiscard]] explicit operator bool() const noexcept {
+            return *data_ != std::byte{0};
+        }
+
+        // Returns the EncodingTraits<T>::View of the value, the optional must contain it
+        typename EncodingTraits<T>::View operator*() const {
+            return EncodingTraits<T>::MakeView(data_ + 1);
+        }
+
+        [[nodiscard]] const std::byte* Data() const noexcept {
+            return data_;
+        }
+
+        [[nodiscard]] Optional<T> Decode() const {
+            return EncodingTraits<Optional<T>>::Read(data_);
+        }
+
+    private:
+        const std::byte* data_;
+    };
+
+}
+
+namespace cpp {
+
+    // An optional is stored as a byte that is 1 if the value is present, followed by the encoding of the value
+    template <typename T>
+    struct EncodingTraits<optional::Optional<T>> {
+        using View = optional::EncodedOptional<T>;
+
+        static constexpr size_t Size(const optional::Optional<T>& value) {
+            return value ? 1 + EncodingTraits<T>::Size(*value) : 1;
+        }
+
+        static std::byte* Write(const optional::Optional<T>& value, std::byte* data) {
+            *data = static_cast<std::byte>(static_cast<bool>(value));
+            return value ? EncodingTraits<T>::Write(*value, data + 1) : data + 1;
+        }
+
+        static size_t EncodedSize(const std::byte* data, size_t available);
+
+        static optional::Optional<T> Read(const std::byte* data) {
+            if (*data == std::byte{0}) {
+                return optional::nullopt;
+            }
+            return optional::Optional<T>(optional::in_place, EncodingTraits<T>::Read(data + 1));
+        }
+
+        static View MakeView(const std::byte* data) noexcept {
+            return View(data);
+        }
+    };
+
+
+    // Implementation
+    template <typename T>
+    size_t EncodingTraits<optional::Optional<T>>::EncodedSize(const std::byte* data, size_t available) {
+        if (available == 0 || std::to_integer<unsigned>(*data) > 1) {
+            throw BadEncoding("Encoded optional has an invalid flag");
+        }
+        return *data == std::byte{0} ? 1 : 1 + EncodingTraits<T>::EncodedSize(data + 1, available - 1);
+    }
+
+}
+
+#endif //CPP_IMPLEMENTATIONS_OPTIONAL_SERIALIZATION_H
@@ -0,0 +1,174 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "cpp_signal.h"
+#include "sharded_signal.h"
+
+namespace {
+
+    using Signal = cpp::signal::Signal<void(uint64_t)>;
+
+    constexpr size_t kSlotsCount = 64;
+    constexpr size_t kCyclesCount = 1'000'000;
+
+    template <typename F>
+    void Measure(const char* name, F&& function) {
+        const auto start = std::chrono::steady_clock::now();
+        function();
+        const auto finish = std::chrono::steady_clock::now();
+        const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(finish - start).count();
+        std::cout << name << ": " << elapsed / kCyclesCount << " ns/cycle" << std::endl;
+    }
+
+    void ConnectSlots(Signal& signal, std::vector<Signal::Connection>& connections, uint64_t& sum) {
+        for (size_t i = 0; i < kSlotsCount; i++) {
+            connections.push_back(signal.Connect([&sum](uint64_t value) { sum += value; }));
+        }
+    }
+
+    void BenchmarkDisconnectReconnect() {
+        Signal signal{};
+        uint64_t sum = 0;
+        std::vector<Signal::Connection> connections;
+        ConnectSlots(signal, connections, sum);
+
+        Measure("Disconnect/Reconnect", [&] {
+            for (size_t i = 0; i < kCyclesCount; i++) {
+                auto& connection = connections[i % kSlotsCount];
+                connection.Disconnect();
+                signal(i);
+                connection = signal.Connect([&sum](uint64_t value) { sum += value; });
+            }
+        });
+        std::cout << "Sum: " << sum << std::endl;
+    }
+
+    void BenchmarkBlockUnblock() {
+        Signal signal{};
+        uint64_t sum = 0;
+        std::vector<Signal::Connection> connections;
+        ConnectSlots(signal, connections, sum);
+
+        Measure("Block/Unblock", [&] {
+            for (size_t i = 0; i < kCyclesCount; i++) {
+                Signal::SharedConnectionBlock block{connections[i % kSlotsCount]};
+                signal(i);
+            }
+        });
+        std::cout << "Sum: " << sum << std::endl;
+    }
+
+    void BenchmarkFullyBlocked() {
+        Signal signal{};
+        uint64_t sum = 0;
+        std::vector<Signal::Connection> connections;
+        ConnectSlots(signal, connections, sum);
+
+        std::vector<Signal::SharedConnectionBlock> blocks;
+        for (auto& connection : connections) {
+            blocks.emplace_back(connection);
+        }
+
+        Measure("Fully blocked emission", [&] {
+            for (size_t i = 0; i < kCyclesCount; i++) {
+                signal(i);
+            }
+        });
+        std::cout << "Sum: " << sum << std::endl;
+    }
+
+
+    template <typename TracedSignal>
+    void BenchmarkEmission(const char* name) {
+        TracedSignal signal{};
+        uint64_t sum = 0;
+        std::vector<typename TracedSignal::Connection> connections;
+        for (size_t i = 0; i < kSlotsCount; i++) {
+            connections.push_back(signal.Connect([&sum](uint64_t value) { sum += value; }, "sum"));
+        }
+
+        Measure(name, [&] {
+            for (size_t i = 0; i < kCyclesCount; i++) {
+                signal(i);
+            }
+        });
+        std::cout << "Sum: " << sum << std::endl;
+    }
+
+    void BenchmarkTracing() {
+        BenchmarkEmission<Signal>("Emission without tracing");
+        BenchmarkEmission<cpp::signal::Signal<void(uint64_t), cpp::signal::SlotTracing>>("Emission with tracing");
+    }
+
+
+    constexpr size_t kEmissionsPerThread = 200'000;
+    constexpr size_t kShardedSlotsCount = 8;
+
+    uint64_t& ThreadLocalSum() {
+        thread_local uint64_t sum = 0;
+        return sum;
+    }
+
+    template <typename F>
+    void MeasureScaling(const char* name, size_t threads_count, F&& emit) {
+        std::vector<std::thread> threads;
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < threads_count; i++) {
+            threads.emplace_back([&emit] {
+                for (size_t j = 0; j < kEmissionsPerThread; j++) {
+                    emit(j);
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        const auto finish = std::chrono::steady_clock::now();
+        const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(finish - start).count();
+        const auto emissions_count = static_cast<double>(kEmissionsPerThread * threads_count);
+        std::cout << name << " threads=" << threads_count << ": "
+                  << emissions_count / static_cast<double>(elapsed) * 1e3 << " M emissions/s" << std::endl;
+    }
+
+    void BenchmarkEmissionScaling() {
+        const size_t max_threads_count = std::max(std::thread::hardware_concurrency(), 4u);
+
+        for (size_t threads_count = 1; threads_count <= max_threads_count; threads_count *= 2) {
+            Signal signal{};
+            std::mutex mutex;
+            std::vector<Signal::Connection> connections;
+            for (size_t i = 0; i < kShardedSlotsCount; i++) {
+                connections.push_back(signal.Connect([](uint64_t value) { ThreadLocalSum() += value; }));
+            }
+
+            MeasureScaling("Mutex-guarded Signal", threads_count, [&](uint64_t value) {
+                std::lock_guard lock(mutex);
+                signal(value);
+            });
+        }
+
+        for (size_t threads_count = 1; threads_count <= max_threads_count; threads_count *= 2) {
+            cpp::signal::ShardedSignal<void(uint64_t)> signal{max_threads_count + 1};
+            std::vector<cpp::signal::ShardedSignal<void(uint64_t)>::Connection> connections;
+            for (size_t i = 0; i < kShardedSlotsCount; i++) {
+                connections.push_back(signal.Connect([](uint64_t value) { ThreadLocalSum() += value; }));
+            }
+
+            MeasureScaling("ShardedSignal", threads_count, [&](uint64_t value) { signal(value); });
+        }
+    }
+
+}
+
+int main() {
+    BenchmarkDisconnectReconnect();
+    BenchmarkBlockUnblock();
+    BenchmarkFullyBlocked();
+    BenchmarkEmissionScaling();
+    BenchmarkTracing();
+    return 0;
+}
@@ -2,25 +2,70 @@
 #define CPP_IMPLEMENTATIONS_CPP_SIGNAL_H
 
 #include "intrusive_list/intrusive_list.h"
+#include "signal_tracing.h"
+#include <algorithm>
 #include <functional>
+#include <ostream>
+#include <string_view>
+#include <type_traits>
+#include <vector>
 
 namespace cpp::signal {
 
-    template <typename T>
+    template <typename T, typename Tracer = NoTracing>
     class Signal;
 
-    template <typename... Args>
-    class Signal<void(Args...)> {
+    template <typename Tracer, typename... Args>
+    class Signal<void(Args...), Tracer> {
     private:
         using Slot = std::function<void(Args...)>;
 
     public:
-        class Connection : public cpp::intrusive::ListElement<class ConnectionTag> {
+        class Connection;
+
+        // Mutes the slot of the connection without unlinking it from the signal.
+        // Blocks are counted, so the slot is invoked again only after the last block is released.
+        // Every block is linked into its connection, so it follows the connection when it is moved
+        // and is detached when the connection is destroyed.
+        class SharedConnectionBlock : public cpp::intrusive::ListElement<class BlockTag> {
+        public:
+            explicit SharedConnectionBlock(Connection& connection, bool initially_blocking = true);
+
+            SharedConnectionBlock(const SharedConnectionBlock& other);
+            SharedConnectionBlock& operator=(const SharedConnectionBlock& other);
+
+            ~SharedConnectionBlock();
+
+            void Block();
+            void Unblock();
+
+            [[nodiscard]] bool IsBlocking() const noexcept;
+
+            friend class Connection;
+
         private:
-            Connection(Signal* signal, Slot slot);
+            void Attach(Connection* connection);
+
+        private:
+            Connection* connection_{nullptr};
+            bool is_blocking_{false};
+
+        };
+
+        // Disconnect always unlinks the connection, so the hook does not have to unlink it again on destruction
+        class Connection : public cpp::intrusive::ListElement<class ConnectionTag, cpp::intrusive::LinkMode::kNormal> {
+        private:
+            Connection(Signal* signal, Slot slot, std::string_view label);
 
             void Replace(Connection& other);
 
+            // Re-points the blocks of other to this connection, the block count must be taken over already
+            void AdoptBlocks(Connection& other) noexcept;
+            void DetachBlocks() noexcept;
+
+            void Block() noexcept;
+            void Unblock() noexcept;
+
         public:
             Connection() = default;
 
@@ -30,14 +75,50 @@ namespace cpp::signal {
             Connection(Connection&& other);
             Connection& operator=(Connection&& other);
 
+            ~Connection();
+
             void Disconnect();
 
-            template <typename T>
+            [[nodiscard]] bool IsConnected() const noexcept;
+            [[nodiscard]] bool IsBlocked() const noexcept;
+
+            template <typename T, typename Tracer_>
             friend class Signal;
 
+            friend class SharedConnectionBlock;
+
         private:
             Signal* signal_{nullptr};
             Slot slot_;
+            size_t block_count_{0};
+            cpp::intrusive::List<SharedConnectionBlock, BlockTag> blocks_{};
+            [[no_unique_address]] typename Tracer::ConnectionData trace_data_{};
+
+        };
+
+        // Disconnects the owned connection on destruction.
+        class ScopedConnection {
+        public:
+            ScopedConnection() = default;
+            ScopedConnection(Connection&& connection);
+
+            ScopedConnection(const ScopedConnection&) = delete;
+            ScopedConnection& operator=(const ScopedConnection&) = delete;
+
+            ScopedConnection(ScopedConnection&& other) = default;
+            ScopedConnection& operator=(ScopedConnection&& other);
+            ScopedConnection& operator=(Connection&& connection);
+
+            ~ScopedConnection();
+
+            void Disconnect();
+
+            Connection Release();
+
+            [[nodiscard]] bool IsConnected() const noexcept;
+
+        private:
+            Connection connection_{};
 
         };
 
@@ -50,9 +131,15 @@ namespace cpp::signal {
         Signal& operator=(Signal&&) = delete;
 
         Connection Connect(std::function<void(Args...)> slot);
+        Connection Connect(std::function<void(Args...)> slot, std::string_view label);
 
         void operator()(Args... args);
 
+        // Returns the statistics of at most n connected slots with the highest maximum latency
+        std::vector<SlotStatistics> SlowestSlots(size_t n) requires Tracer::kEnabled;
+
+        void DumpSlowestSlots(std::ostream& os, size_t n) requires Tracer::kEnabled;
+
         ~Signal();
 
     private:
@@ -63,11 +150,16 @@ namespace cpp::signal {
 
             ~IteratorHolder();
 
-            template <typename T>
+            template <typename T, typename Tracer_>
             friend class Signal;
 
         private:
             cpp::intrusive::List<Connection, ConnectionTag>::const_iterator current_;
+            struct Untraced {};
+
+            // The connection whose slot is running, reset if it is disconnected or the signal is destroyed meanwhile.
+            // Only tracing reads it, so it takes no space and no stores without it.
+            [[no_unique_address]] std::conditional_t<Tracer::kEnabled, const Connection*, Untraced> invoked_{};
             IteratorHolder* next_;
             const Signal* signal_;
         };
@@ -75,34 +167,79 @@ namespace cpp::signal {
     private:
         intrusive::List<Connection, ConnectionTag> connections_{};
         mutable IteratorHolder* top_{nullptr};
+        size_t connections_count_{0};
+        size_t blocked_connections_count_{0};
 
     };
 
 
     // Implementation
-    template <typename... Args>
-    Signal<void(Args...)>::Connection Signal<void(Args...)>::Connect(std::function<void(Args...)> slot) {
-        return Connection(this, std::move(slot));
+    template <typename Tracer, typename... Args>
+    Signal<void(Args...), Tracer>::Connection Signal<void(Args...), Tracer>::Connect(std::function<void(Args...)> slot) {
+        return Connection(this, std::move(slot), {});
     }
 
-    template <typename... Args>
-    void Signal<void(Args...)>::operator()(Args... args) {
+    template <typename Tracer, typename... Args>
+    Signal<void(Args...), Tracer>::Connection Signal<void(Args...), Tracer>::Connect(std::function<void(Args...)> slot, std::string_view label) {
+        return Connection(this, std::move(slot), label);
+    }
+
+    template <typename Tracer, typename... Args>
+    void Signal<void(Args...), Tracer>::operator()(Args... args) {
+        if (blocked_connections_count_ == connections_count_) {
+            return;
+        }
+
         IteratorHolder holder(this);
         while (holder.current_ != connections_.end()) {
             auto copy = holder.current_;
             holder.current_++;
-            copy->slot_(std::forward<Args>(args)...);
+            if (copy->IsBlocked()) {
+                continue;
+            }
+            if constexpr (Tracer::kEnabled) {
+                holder.invoked_ = &*copy;
+                Tracer::Invoke(copy->trace_data_, [&copy, &args...] { copy->slot_(args...); },
+                               [&holder] { return holder.invoked_ != nullptr; });
+            } else {
+                Tracer::Invoke(copy->trace_data_, [&copy, &args...] { copy->slot_(args...); }, [] { return true; });
+            }
             if (holder.signal_ == nullptr) {
                 return;
             }
         }
     }
 
-    template <typename... Args>
-    Signal<void(Args...)>::~Signal() {
+    template <typename Tracer, typename... Args>
+    std::vector<SlotStatistics> Signal<void(Args...), Tracer>::SlowestSlots(size_t n) requires Tracer::kEnabled {
+        std::vector<SlotStatistics> statistics;
+        statistics.reserve(connections_count_);
+        for (auto& connection : connections_) {
+            statistics.push_back(connection.trace_data_.Statistics());
+        }
+
+        auto by_max_latency = [](const SlotStatistics& a, const SlotStatistics& b) {
+            return a.latency.Max() > b.latency.Max();
+        };
+        n = std::min(n, statistics.size());
+        std::partial_sort(statistics.begin(), statistics.begin() + static_cast<std::ptrdiff_t>(n), statistics.end(), by_max_latency);
+        statistics.resize(n);
+        return statistics;
+    }
+
+    template <typename Tracer, typename... Args>
+    void Signal<void(Args...), Tracer>::DumpSlowestSlots(std::ostream& os, size_t n) requires Tracer::kEnabled {
+        for (const auto& statistics : SlowestSlots(n)) {
+            os << statistics << std::endl;
+        }
+    }
+
+    template <typename Tracer, typename... Args>
+    Signal<void(Args...), Tracer>::~Signal() {
         for (auto it = top_; it != nullptr; it = it->next_) {
-            if (it->current_ != connections_.cend()) {
-                it->signal_ = nullptr;
+            it->signal_ = nullptr;
+            if constexpr (Tracer::kEnabled) {
+                it->invoked_ = nullptr;
             }
         }
 
@@ -114,63 +251,252 @@ namespace cpp::signal {
 
 
     // Connection
-    template <typename... Args>
-    Signal<void(Args...)>::Connection::Connection(Signal* signal, std::function<void(Args...)> slot) : signal_(signal), slot_(slot) {
+    template <typename Tracer, typename... Args>
+    Signal<void(Args...), Tracer>::Connection::Connection(Signal* signal, std::function<void(Args...)> slot, std::string_view label)
+            : signal_(signal), slot_(std::move(slot)), trace_data_(label) {
         signal_->connections_.PushBack(*this);
+        ++signal_->connections_count_;
     }
 
-    template <typename... Args>
-    Signal<void(Args...)>::Connection::Connection(Signal<void(Args...)>::Connection&& other) : slot_(std::move(other.slot_)) {
+    template <typename Tracer, typename... Args>
+    Signal<void(Args...), Tracer>::Connection::Connection(Signal<void(Args...), Tracer>::Connection&& other)
+            : slot_(std::move(other.slot_)), trace_data_(std::move(other.trace_data_)) {
         signal_ = other.signal_;
+        block_count_ = other.block_count_;
         if (other.signal_ != nullptr) {
             Replace(other);
         }
+        AdoptBlocks(other);
     }
 
-    template <typename... Args>
-    Signal<void(Args...)>::Connection& Signal<void(Args...)>::Connection::operator=(Signal<void(Args...)>::Connection&& other) {
+    template <typename Tracer, typename... Args>
+    Signal<void(Args...), Tracer>::Connection& Signal<void(Args...), Tracer>::Connection::operator=(Signal<void(Args...), Tracer>::Connection&& other) {
         if (this != &other) {
             Disconnect();
+            DetachBlocks();
 
             signal_ = other.signal_;
             slot_ = std::move(other.slot_);
+            block_count_ = other.block_count_;
+            trace_data_ = std::move(other.trace_data_);
 
             if (other.signal_) {
                 Replace(other);
             }
+            AdoptBlocks(other);
         }
         return *this;
     }
 
-    template<typename... Args>
-    void Signal<void(Args...)>::Connection::Disconnect() {
-        if (IsLinked()) {
-            for (auto it = signal_->top; it != nullptr; it = it->next_) {
-                if (it->current != signal_->connections.end() && &(*it->current_) == this) {
-                    it->current++;
+    template <typename Tracer, typename... Args>
+    Signal<void(Args...), Tracer>::Connection::~Connection() {
+        Disconnect();
+        DetachBlocks();
+    }
+
+    template <typename Tracer, typename... Args>
+    void Signal<void(Args...), Tracer>::Connection::Disconnect() {
+        if (signal_ == nullptr) {
+            return;
+        }
+
+        for (auto it = signal_->top_; it != nullptr; it = it->next_) {
+            if (it->current_ != signal_->connections_.cend() && &(*it->current_) == this) {
+                it->current_++;
+            }
+            if constexpr (Tracer::kEnabled) {
+                if (it->invoked_ == this) {
+                    it->invoked_ = nullptr;
                 }
             }
         }
+
+        --signal_->connections_count_;
+        if (IsBlocked()) {
+            --signal_->blocked_connections_count_;
+        }
+
         Unlink();
         signal_ = nullptr;
     }
 
-    template <typename... Args>
-    void Signal<void(Args...)>::Connection::Replace(Signal<void(Args...)>::Connection& other) {
-        other.signal_->connections_.Insert(signal_->connections_.GetIterator(other), *this);
+    template <typename Tracer, typename... Args>
+    bool Signal<void(Args...), Tracer>::Connection::IsConnected() const noexcept {
+        return signal_ != nullptr;
+    }
+
+    template <typename Tracer, typename... Args>
+    bool Signal<void(Args...), Tracer>::Connection::IsBlocked() const noexcept {
+        return block_count_ != 0;
+    }
+
+    template <typename Tracer, typename... Args>
+    void Signal<void(Args...), Tracer>::Connection::Block() noexcept {
+        if (block_count_++ == 0 && signal_ != nullptr) {
+            ++signal_->blocked_connections_count_;
+        }
+    }
+
+    template <typename Tracer, typename... Args>
+    void Signal<void(Args...), Tracer>::Connection::Unblock() noexcept {
+        if (block_count_ == 0) {
+            return;
+        }
+        if (--block_count_ == 0 && signal_ != nullptr) {
+            --signal_->blocked_connections_count_;
+        }
+    }
+
+    template <typename Tracer, typename... Args>
+    void Signal<void(Args...), Tracer>::Connection::Replace(Signal<void(Args...), Tracer>::Connection& other) {
+        auto position = signal_->connections_.GetIterator(other);
+        signal_->connections_.Insert(++position, *this);
+
+        ++signal_->connections_count_;
+        if (IsBlocked()) {
+            ++signal_->blocked_connections_count_;
+        }
+
         other.Disconnect();
+        other.block_count_ = 0;
+    }
+
+    template <typename Tracer, typename... Args>
+    void Signal<void(Args...), Tracer>::Connection::AdoptBlocks(Signal<void(Args...), Tracer>::Connection& other) noexcept {
+        for (auto& block : other.blocks_) {
+            block.connection_ = this;
+        }
+        blocks_.Splice(blocks_.cend(), other.blocks_);
+        other.block_count_ = 0;
+    }
+
+    template <typename Tracer, typename... Args>
+    void Signal<void(Args...), Tracer>::Connection::DetachBlocks() noexcept {
+        while (!blocks_.IsEmpty()) {
+            SharedConnectionBlock* block = blocks_.Front();
+            blocks_.PopFront();
+            block->connection_ = nullptr;
+            block->is_blocking_ = false;
+        }
+        block_count_ = 0;
+    }
+
+
+    // ScopedConnection
+    template <typename Tracer, typename... Args>
+    Signal<void(Args...), Tracer>::ScopedConnection::ScopedConnection(Connection&& connection)
+            : connection_(std::move(connection)) {}
+
+    template <typename Tracer, typename... Args>
+    Signal<void(Args...), Tracer>::ScopedConnection& Signal<void(Args...), Tracer>::ScopedConnection::operator=(ScopedConnection&& other) {
+        connection_ = std::move(other.connection_);
+        return *this;
+    }
+
+    template <typename Tracer, typename... Args>
+    Signal<void(Args...), Tracer>::ScopedConnection& Signal<void(Args...), Tracer>::ScopedConnection::operator=(Connection&& connection) {
+        connection_ = std::move(connection);
+        return *this;
+    }
+
+    template <typename Tracer, typename... Args>
+    Signal<void(Args...), Tracer>::ScopedConnection::~ScopedConnection() {
+        connection_.Disconnect();
+    }
+
+    template <typename Tracer, typename... Args>
+    void Signal<void(Args...), Tracer>::ScopedConnection::Disconnect() {
+        connection_.Disconnect();
+    }
+
+    template <typename Tracer, typename... Args>
+    Signal<void(Args...), Tracer>::Connection Signal<void(Args...), Tracer>::ScopedConnection::Release() {
+        return std::move(connection_);
+    }
+
+    template <typename Tracer, typename... Args>
+    bool Signal<void(Args...), Tracer>::ScopedConnection::IsConnected() const noexcept {
+        return connection_.IsConnected();
+    }
+
+
+    // SharedConnectionBlock
+    template <typename Tracer, typename... Args>
+    Signal<void(Args...), Tracer>::SharedConnectionBlock::SharedConnectionBlock(Connection& connection, bool initially_blocking) {
+        Attach(&connection);
+        if (initially_blocking) {
+            Block();
+        }
+    }
+
+    template <typename Tracer, typename... Args>
+    Signal<void(Args...), Tracer>::SharedConnectionBlock::SharedConnectionBlock(const SharedConnectionBlock& other)
+            : cpp::intrusive::ListElement<BlockTag>() {
+        Attach(other.connection_);
+        if (other.is_blocking_) {
+            Block();
+        }
+    }
+
+    template <typename Tracer, typename... Args>
+    Signal<void(Args...), Tracer>::SharedConnectionBlock& Signal<void(Args...), Tracer>::SharedConnectionBlock::operator=(const SharedConnectionBlock& other) {
+        if (this != &other) {
+            Unblock();
+            Attach(other.connection_);
+            if (other.is_blocking_) {
+                Block();
+            }
+        }
+        return *this;
+    }
+
+    template <typename Tracer, typename... Args>
+    Signal<void(Args...), Tracer>::SharedConnectionBlock::~SharedConnectionBlock() {
+        Unblock();
+    }
+
+    template <typename Tracer, typename... Args>
+    void Signal<void(Args...), Tracer>::SharedConnectionBlock::Block() {
+        if (!is_blocking_ && connection_ != nullptr) {
+            connection_->Block();
+            is_blocking_ = true;
+        }
+    }
+
+    template <typename Tracer, typename... Args>
+    void Signal<void(Args...), Tracer>::SharedConnectionBlock::Unblock() {
+        if (is_blocking_) {
+            connection_->Unblock();
+            is_blocking_ = false;
+        }
+    }
+
+    template <typename Tracer, typename... Args>
+    bool Signal<void(Args...), Tracer>::SharedConnectionBlock::IsBlocking() const noexcept {
+        return is_blocking_;
+    }
+
+    template <typename Tracer, typename... Args>
+    void Signal<void(Args...), Tracer>::SharedConnectionBlock::Attach(Connection* connection) {
+        if (IsLinked()) {
+            Unlink();
+        }
+        connection_ = connection;
+        if (connection_ != nullptr) {
+            connection_->blocks_.PushBack(*this);
+        }
     }
 
 
     // IteratorHolder
-    template <typename... Args>
-    Signal<void(Args...)>::IteratorHolder::IteratorHolder(Signal* signal)
+    template <typename Tracer, typename... Args>
+    Signal<void(Args...), Tracer>::IteratorHolder::IteratorHolder(Signal* signal)
             : current_(signal->connections_.begin()), next_(signal->top_), signal_(signal) {
         signal_->top_ = this;
     }
 
-    template <typename... Args>
-    Signal<void(Args...)>::IteratorHolder::~IteratorHolder() {
+    template <typename Tracer, typename... Args>
+    Signal<void(Args...), Tracer>::IteratorHolder::~IteratorHolder() {
         if (signal_ != nullptr) {
             signal_->top_ = next_;
         }
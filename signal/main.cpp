@@ -1,6 +1,11 @@
 #include <iostream>
 #include "cpp_signal.h"
+#include "sharded_signal.h"
+#include <atomic>
 #include <cassert>
+#include <chrono>
+#include <optional>
+#include <thread>
 
 int main() {
     cpp::signal::Signal<void()> signal{};
@@ -23,5 +28,95 @@ int main() {
     assert(2 == got2);
     std::cout << "Got1: " << got1 << " Got2: " << got2 << std::endl;
 
+    {
+        cpp::signal::Signal<void()>::SharedConnectionBlock block{conn1};
+        signal();
+
+        assert(2 == got1);
+        assert(3 == got2);
+        assert(conn1.IsBlocked());
+    }
+    assert(!conn1.IsBlocked());
+
+    {
+        // The block follows the connection when it is moved and is detached when it is destroyed
+        cpp::signal::Signal<void()> local_signal;
+        int got_moved = 0;
+        auto moved = local_signal.Connect([&] { ++got_moved; });
+        cpp::signal::Signal<void()>::SharedConnectionBlock block{moved};
+        cpp::signal::Signal<void()>::ScopedConnection scoped{std::move(moved)};
+        local_signal();
+        assert(0 == got_moved);
+        block.Unblock();
+        local_signal();
+        assert(1 == got_moved);
+        block.Block();
+        scoped.Disconnect();
+        scoped = cpp::signal::Signal<void()>::ScopedConnection{};
+        assert(!block.IsBlocking());
+    }
+
+    {
+        cpp::signal::Signal<void()>::ScopedConnection scoped = signal.Connect([&] { ++got2; });
+        signal();
+
+        assert(3 == got1);
+        assert(5 == got2);
+    }
+    signal();
+
+    assert(4 == got1);
+    assert(6 == got2);
+    std::cout << "Got1: " << got1 << " Got2: " << got2 << std::endl;
+
+    conn1.Disconnect();
+    cpp::signal::Signal<void()>::SharedConnectionBlock block{conn2};
+    signal();
+
+    assert(4 == got1);
+    assert(6 == got2);
+
+    cpp::signal::ShardedSignal<void(uint32_t)> sharded_signal{};
+
+    std::atomic<uint32_t> sharded_got{0};
+    auto sharded_conn = sharded_signal.Connect([&](uint32_t value) { sharded_got += value; });
+
+    std::thread emitter([&] { sharded_signal(1); });
+    emitter.join();
+    sharded_signal(2);
+    assert(3 == sharded_got);
+
+    sharded_conn.Disconnect();
+    sharded_signal(4);
+    assert(3 == sharded_got);
+    std::cout << "Sharded got: " << sharded_got << std::endl;
+
+    cpp::signal::Signal<void(), cpp::signal::SlotTracing> traced_signal{};
+
+    auto fast_conn = traced_signal.Connect([] {}, "fast");
+    auto slow_conn = traced_signal.Connect([] { std::this_thread::sleep_for(std::chrono::milliseconds(1)); }, "slow");
+
+    traced_signal();
+    traced_signal();
+
+    auto slowest = traced_signal.SlowestSlots(1);
+    assert(1 == slowest.size());
+    assert("slow" == slowest[0].label);
+    assert(2 == slowest[0].Invocations());
+    traced_signal.DumpSlowestSlots(std::cout, 2);
+
+    // The slot destroys its own connection, the latency of this call is not recorded
+    cpp::signal::Signal<void(), cpp::signal::SlotTracing> self_disconnecting_signal{};
+    uint32_t self_disconnecting_got = 0;
+    std::optional<cpp::signal::Signal<void(), cpp::signal::SlotTracing>::ScopedConnection> self_disconnecting_conn;
+    self_disconnecting_conn.emplace(self_disconnecting_signal.Connect([&] {
+        ++self_disconnecting_got;
+        self_disconnecting_conn.reset();
+    }, "self-disconnecting"));
+    self_disconnecting_signal();
+    self_disconnecting_signal();
+    assert(1 == self_disconnecting_got);
+    assert(self_disconnecting_signal.SlowestSlots(1).empty());
+
     return 0;
 }
@@ -0,0 +1,314 @@
+#ifndef CPP_IMPLEMENTATIONS_SHARDED_SIGNAL_H
+#define CPP_IMPLEMENTATIONS_SHARDED_SIGNAL_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace cpp::signal {
+
+    namespace details {
+
+        inline constexpr size_t kCacheLineSize = 64;
+
+        // Hands out dense indices to the running threads. The index is returned to the pool when the thread exits,
+        // so at any moment the indices of the live threads are unique and as small as possible.
+        class ThreadIndexPool {
+        public:
+            static ThreadIndexPool& Instance() {
+                static ThreadIndexPool pool{};
+                return pool;
+            }
+
+            size_t Acquire() {
+                std::lock_guard lock(mutex_);
+                if (free_indices_.empty()) {
+                    return next_index_++;
+                }
+                const size_t index = free_indices_.back();
+                free_indices_.pop_back();
+                return index;
+            }
+
+            void Release(size_t index) {
+                std::lock_guard lock(mutex_);
+                free_indices_.push_back(index);
+            }
+
+        private:
+            std::mutex mutex_;
+            std::vector<size_t> free_indices_;
+            size_t next_index_{0};
+        };
+
+        class ThreadIndexHolder {
+        public:
+            ThreadIndexHolder() : index_(ThreadIndexPool::Instance().Acquire()) {}
+
+            ThreadIndexHolder(const ThreadIndexHolder&) = delete;
+            ThreadIndexHolder& operator=(const ThreadIndexHolder&) = delete;
+
+            ~ThreadIndexHolder() {
+                ThreadIndexPool::Instance().Release(index_);
+            }
+
+            [[nodiscard]] size_t Index() const noexcept {
+                return index_;
+            }
+
+        private:
+            const size_t index_;
+        };
+
+        inline size_t ThisThreadIndex() {
+            thread_local const ThreadIndexHolder holder{};
+            return holder.Index();
+        }
+
+    } // End of namespace cpp::signal::details
+
+
+    template <typename T>
+    class ShardedSignal;
+
+    // Signal whose slots are registered once globally and replicated into per-thread shards.
+    // Emission reads only the shard of the calling thread, Connect and Disconnect bump a version
+    // and every shard copies the registrations again before its next emission.
+    // A shard is touched only by its own thread, so Disconnect can not drop the copies of the slot:
+    // emissions started after Disconnect do not call the slot, but the slot object itself is destroyed
+    // only when every shard holding it is refreshed by an emission of its thread, or with the signal.
+    template <typename... Args>
+    class ShardedSignal<void(Args...)> {
+    private:
+        using Slot = std::function<void(Args...)>;
+
+        class State;
+
+    public:
+        class Connection {
+        private:
+            Connection(const std::shared_ptr<State>& state, uint64_t id);
+
+        public:
+            Connection() = default;
+
+            Connection(const Connection&) = delete;
+            Connection& operator=(const Connection&) = delete;
+
+            Connection(Connection&& other) noexcept;
+            Connection& operator=(Connection&& other) noexcept;
+
+            ~Connection();
+
+            void Disconnect();
+
+            template <typename T>
+            friend class ShardedSignal;
+
+        private:
+            std::weak_ptr<State> state_;
+            uint64_t id_{0};
+
+        };
+
+    public:
+        explicit ShardedSignal(size_t shards_count = std::max(std::thread::hardware_concurrency(), 1u));
+
+        ShardedSignal(const ShardedSignal&) = delete;
+        ShardedSignal(ShardedSignal&&) = delete;
+        ShardedSignal& operator=(const ShardedSignal&) = delete;
+        ShardedSignal& operator=(ShardedSignal&&) = delete;
+
+        ~ShardedSignal() = default;
+
+        Connection Connect(Slot slot);
+
+        void operator()(Args... args);
+
+    private:
+        struct Registration {
+            uint64_t id;
+            std::shared_ptr<const Slot> slot;
+        };
+
+        struct alignas(details::kCacheLineSize) Shard {
+            uint64_t version{0};
+            size_t emission_depth{0};
+            std::vector<std::shared_ptr<const Slot>> slots;
+        };
+
+        class State {
+        public:
+            explicit State(size_t shards_count);
+
+            uint64_t Connect(Slot slot);
+            void Disconnect(uint64_t id);
+
+            void Emit(Args... args);
+
+        private:
+            void EmitFromShard(Shard& shard, Args... args);
+            void EmitUnderLock(Args... args);
+
+            void RefreshShard(Shard& shard);
+
+        private:
+            std::mutex mutex_;
+            std::vector<Registration> registrations_;
+            uint64_t next_id_{1};
+            std::atomic<uint64_t> version_{1};
+            std::vector<Shard> shards_;
+        };
+
+    private:
+        std::shared_ptr<State> state_;
+
+    };
+
+
+    // Implementation
+    template <typename... Args>
+    ShardedSignal<void(Args...)>::ShardedSignal(size_t shards_count)
+            : state_(std::make_shared<State>(shards_count)) {}
+
+    template <typename... Args>
+    ShardedSignal<void(Args...)>::Connection ShardedSignal<void(Args...)>::Connect(Slot slot) {
+        return Connection(state_, state_->Connect(std::move(slot)));
+    }
+
+    template <typename... Args>
+    void ShardedSignal<void(Args...)>::operator()(Args... args) {
+        state_->Emit(args...);
+    }
+
+
+    // State
+    template <typename... Args>
+    ShardedSignal<void(Args...)>::State::State(size_t shards_count) : shards_(shards_count) {}
+
+    template <typename... Args>
+    uint64_t ShardedSignal<void(Args...)>::State::Connect(Slot slot) {
+        std::lock_guard lock(mutex_);
+        const uint64_t id = next_id_++;
+        registrations_.push_back(Registration{id, std::make_shared<const Slot>(std::move(slot))});
+        version_.fetch_add(1, std::memory_order_release);
+        return id;
+    }
+
+    template <typename... Args>
+    void ShardedSignal<void(Args...)>::State::Disconnect(uint64_t id) {
+        // The global reference to the slot is released outside of the lock, its destructor may be arbitrary user code.
+        // The shards keep their references until their threads emit again.
+        std::shared_ptr<const Slot> slot;
+        {
+            std::lock_guard lock(mutex_);
+            auto it = std::find_if(registrations_.begin(), registrations_.end(),
+                                   [id](const Registration& registration) { return registration.id == id; });
+            if (it == registrations_.end()) {
+                return;
+            }
+            slot = std::move(it->slot);
+            registrations_.erase(it);
+            version_.fetch_add(1, std::memory_order_release);
+        }
+    }
+
+    template <typename... Args>
+    void ShardedSignal<void(Args...)>::State::Emit(Args... args) {
+        const size_t index = details::ThisThreadIndex();
+        if (index < shards_.size()) {
+            EmitFromShard(shards_[index], args...);
+        } else {
+            EmitUnderLock(args...);
+        }
+    }
+
+    template <typename... Args>
+    void ShardedSignal<void(Args...)>::State::EmitFromShard(Shard& shard, Args... args) {
+        if (shard.emission_depth == 0 && shard.version != version_.load(std::memory_order_acquire)) {
+            RefreshShard(shard);
+        }
+
+        ++shard.emission_depth;
+        const size_t slots_count = shard.slots.size();
+        for (size_t i = 0; i < slots_count; i++) {
+            (*shard.slots[i])(args...);
+        }
+        --shard.emission_depth;
+    }
+
+    template <typename... Args>
+    void ShardedSignal<void(Args...)>::State::EmitUnderLock(Args... args) {
+        std::vector<std::shared_ptr<const Slot>> slots;
+        {
+            std::lock_guard lock(mutex_);
+            slots.reserve(registrations_.size());
+            for (const auto& registration : registrations_) {
+                slots.push_back(registration.slot);
+            }
+        }
+
+        for (const auto& slot : slots) {
+            (*slot)(args...);
+        }
+    }
+
+    template <typename... Args>
+    void ShardedSignal<void(Args...)>::State::RefreshShard(Shard& shard) {
+        std::vector<std::shared_ptr<const Slot>> stale_slots;
+        {
+            std::lock_guard lock(mutex_);
+            stale_slots.swap(shard.slots);
+            shard.slots.reserve(registrations_.size());
+            for (const auto& registration : registrations_) {
+                shard.slots.push_back(registration.slot);
+            }
+            shard.version = version_.load(std::memory_order_relaxed);
+        }
+    }
+
+
+    // Connection
+    template <typename... Args>
+    ShardedSignal<void(Args...)>::Connection::Connection(const std::shared_ptr<State>& state, uint64_t id)
+            : state_(state), id_(id) {}
+
+    template <typename... Args>
+    ShardedSignal<void(Args...)>::Connection::Connection(Connection&& other) noexcept
+            : state_(std::move(other.state_)), id_(other.id_) {
+        other.id_ = 0;
+    }
+
+    template <typename... Args>
+    ShardedSignal<void(Args...)>::Connection& ShardedSignal<void(Args...)>::Connection::operator=(Connection&& other) noexcept {
+        if (this != &other) {
+            Disconnect();
+            state_ = std::move(other.state_);
+            id_ = other.id_;
+            other.id_ = 0;
+        }
+        return *this;
+    }
+
+    template <typename... Args>
+    ShardedSignal<void(Args...)>::Connection::~Connection() {
+        Disconnect();
+    }
+
+    template <typename... Args>
+    void ShardedSignal<void(Args...)>::Connection::Disconnect() {
+        if (auto state = state_.lock()) {
+            state->Disconnect(id_);
+        }
+        state_.reset();
+        id_ = 0;
+    }
+
+} // End of namespace cpp::signal
+
+#endif //CPP_IMPLEMENTATIONS_SHARDED_SIGNAL_H
@@ -0,0 +1,167 @@
+#ifndef CPP_IMPLEMENTATIONS_SIGNAL_TRACING_H
+#define CPP_IMPLEMENTATIONS_SIGNAL_TRACING_H
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace cpp::signal {
+
+    // Log-linear histogram in the spirit of HdrHistogram: every power of two is split into
+    // 2^kSubBucketBits equal buckets, so the relative error of any recorded value is below 1 / 2^kSubBucketBits.
+    class LatencyHistogram {
+    public:
+        static constexpr size_t kSubBucketBits = 3;
+        static constexpr size_t kSubBucketsCount = size_t{1} << kSubBucketBits;
+        static constexpr size_t kBucketsCount = (64 - kSubBucketBits + 1) * kSubBucketsCount;
+
+        void Record(uint64_t value) noexcept {
+            ++buckets_[BucketIndex(value)];
+            ++count_;
+            sum_ += value;
+            max_ = std::max(max_, value);
+        }
+
+        [[nodiscard]] uint64_t Count() const noexcept {
+            return count_;
+        }
+
+        [[nodiscard]] uint64_t Max() const noexcept {
+            return max_;
+        }
+
+        [[nodiscard]] uint64_t Mean() const noexcept {
+            return count_ == 0 ? 0 : sum_ / count_;
+        }
+
+        [[nodiscard]] uint64_t Total() const noexcept {
+            return sum_;
+        }
+
+        // Returns the upper bound of the bucket that contains the given percentile, capped by the maximum
+        [[nodiscard]] uint64_t Percentile(double percentile) const noexcept {
+            if (count_ == 0) {
+                return 0;
+            }
+            const auto rank = std::max<uint64_t>(static_cast<uint64_t>(std::ceil(percentile / 100.0 * static_cast<double>(count_))), 1);
+            uint64_t seen = 0;
+            for (size_t i = 0; i < kBucketsCount; i++) {
+                seen += buckets_[i];
+                if (seen >= rank) {
+                    return std::min(BucketUpperBound(i), max_);
+                }
+            }
+            return max_;
+        }
+
+        static constexpr size_t BucketIndex(uint64_t value) noexcept {
+            if (value < kSubBucketsCount) {
+                return value;
+            }
+            const size_t exponent = std::bit_width(value) - 1;
+            const size_t shift = exponent - kSubBucketBits;
+            const size_t sub_bucket = (value >> shift) & (kSubBucketsCount - 1);
+            return (shift + 1) * kSubBucketsCount + sub_bucket;
+        }
+
+        static constexpr uint64_t BucketUpperBound(size_t index) noexcept {
+            if (index < kSubBucketsCount) {
+                return index;
+            }
+            const size_t shift = index / kSubBucketsCount - 1;
+            const uint64_t lower_bound = (kSubBucketsCount + index % kSubBucketsCount) << shift;
+            return lower_bound + ((uint64_t{1} << shift) - 1);
+        }
+
+    private:
+        std::array<uint64_t, kBucketsCount> buckets_{};
+        uint64_t count_{0};
+        uint64_t sum_{0};
+        uint64_t max_{0};
+    };
+
+    struct SlotStatistics {
+        std::string label;
+        LatencyHistogram latency;
+
+        [[nodiscard]] uint64_t Invocations() const noexcept {
+            return latency.Count();
+        }
+
+        friend std::ostream& operator<<(std::ostream& os, const SlotStatistics& statistics) {
+            return os << "Slot=[label=" << statistics.label
+                      << ", invocations=" << statistics.Invocations()
+                      << ", mean=" << statistics.latency.Mean() << "ns"
+                      << ", p50=" << statistics.latency.Percentile(50) << "ns"
+                      << ", p99=" << statistics.latency.Percentile(99) << "ns"
+                      << ", max=" << statistics.latency.Max() << "ns]";
+        }
+    };
+
+
+    // Tracing policies of cpp::signal::Signal.
+    // Every connection stores a ConnectionData, and the signal invokes the slots through Invoke.
+    // The slot may disconnect, move or destroy its own connection, so Invoke touches the ConnectionData
+    // after the call only if is_alive() returns true.
+
+    // Default policy: ConnectionData is empty and Invoke calls the slot directly, so tracing compiles away.
+    struct NoTracing {
+        struct ConnectionData {
+            ConnectionData() = default;
+            explicit ConnectionData(std::string_view) noexcept {}
+        };
+
+        static constexpr bool kEnabled = false;
+
+        template <typename F, typename IsAlive>
+        static void Invoke(const ConnectionData&, F&& slot, IsAlive&&) {
+            std::forward<F>(slot)();
+        }
+    };
+
+    // Records the number of invocations and the latency histogram of every connection.
+    struct SlotTracing {
+        class ConnectionData {
+        public:
+            ConnectionData() : statistics_(std::make_unique<SlotStatistics>()) {}
+
+            explicit ConnectionData(std::string_view label) : ConnectionData() {
+                statistics_->label = label;
+            }
+
+            [[nodiscard]] const SlotStatistics& Statistics() const noexcept {
+                return *statistics_;
+            }
+
+            friend struct SlotTracing;
+
+        private:
+            std::unique_ptr<SlotStatistics> statistics_;
+        };
+
+        static constexpr bool kEnabled = true;
+
+        template <typename F, typename IsAlive>
+        static void Invoke(const ConnectionData& data, F&& slot, IsAlive&& is_alive) {
+            const auto start = std::chrono::steady_clock::now();
+            std::forward<F>(slot)();
+            const auto finish = std::chrono::steady_clock::now();
+            if (!is_alive()) {
+                return;
+            }
+            const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(finish - start).count();
+            data.statistics_->latency.Record(static_cast<uint64_t>(elapsed));
+        }
+    };
+
+} // End of namespace cpp::signal
+
+#endif //CPP_IMPLEMENTATIONS_SIGNAL_TRACING_H
@@ -0,0 +1,763 @@
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <variant>
+#include <vector>
+#include "variant.h"
+#include "variant_never_valueless.h"
+#include "variant_serialization.h"
+#include "variant_vector.h"
+
+namespace {
+
+    constexpr size_t kVariantsCount = 10'000'000;
+
+    template <typename F>
+    void Measure(const char* name, size_t operations_count, F&& function) {
+        const auto start = std::chrono::steady_clock::now();
+        function();
+        const auto finish = std::chrono::steady_clock::now();
+        const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(finish - start).count();
+        std::cout << name << ": " << static_cast<double>(elapsed) / static_cast<double>(operations_count) << " ns/operation" << std::endl;
+    }
+
+    template <size_t N>
+    struct Message {
+        static constexpr uint64_t kWeight = N + 1;
+
+        uint32_t value_;
+
+        bool operator==(const Message&) const = default;
+    };
+
+    template <typename Sequence>
+    struct MessageVariantImpl;
+
+    template <size_t... Inds>
+    struct MessageVariantImpl<std::index_sequence<Inds...>> {
+        using Type = cpp::variant::Variant<Message<Inds>...>;
+    };
+
+    template <size_t AlternativesCount>
+    using MessageVariant = typename MessageVariantImpl<std::make_index_sequence<AlternativesCount>>::Type;
+
+    template <typename Sequence>
+    struct NeverValuelessMessageVariantImpl;
+
+    template <size_t... Inds>
+    struct NeverValuelessMessageVariantImpl<std::index_sequence<Inds...>> {
+        using Type = cpp::variant::NeverValuelessVariant<Message<Inds>...>;
+    };
+
+    template <size_t AlternativesCount>
+    using NeverValuelessMessageVariant = typename NeverValuelessMessageVariantImpl<std::make_index_sequence<AlternativesCount>>::Type;
+
+    template <size_t AlternativesCount, size_t... Inds>
+    std::vector<MessageVariant<AlternativesCount>> MakeMessages(std::index_sequence<Inds...>) {
+        using Factory = MessageVariant<AlternativesCount> (*)(uint32_t);
+        constexpr Factory kFactories[] = {
+                [](uint32_t value) { return MessageVariant<AlternativesCount>(Message<Inds>{value}); }...
+        };
+
+        std::mt19937 generator{42};
+        std::vector<MessageVariant<AlternativesCount>> messages;
+        messages.reserve(kVariantsCount);
+        for (size_t i = 0; i < kVariantsCount; i++) {
+            messages.push_back(kFactories[generator() % AlternativesCount](static_cast<uint32_t>(i)));
+        }
+        return messages;
+    }
+
+    struct Handler {
+        template <size_t N>
+        uint64_t operator()(const Message<N>& message) const noexcept {
+            return message.value_ * Message<N>::kWeight;
+        }
+    };
+
+    template <size_t AlternativesCount>
+    void BenchmarkVisit() {
+        const auto messages = MakeMessages<AlternativesCount>(std::make_index_sequence<AlternativesCount>());
+        const std::string prefix = std::to_string(AlternativesCount) + " alternatives, ";
+
+        uint64_t switch_sum = 0;
+        Measure((prefix + "Visit").c_str(), kVariantsCount, [&] {
+            for (const auto& message : messages) {
+                switch_sum += cpp::variant::Visit(Handler{}, message);
+            }
+        });
+
+        uint64_t table_sum = 0;
+        Measure((prefix + "function pointer table").c_str(), kVariantsCount, [&] {
+            for (const auto& message : messages) {
+                table_sum += cpp::variant::details::TableVisit(Handler{}, message);
+            }
+        });
+        std::cout << "Sum: " << switch_sum << " " << table_sum << std::endl;
+    }
+
+
+    struct BinaryHandler {
+        template <size_t N, size_t M>
+        uint64_t operator()(const Message<N>& first, const Message<M>& second) const noexcept {
+            return first.value_ * Message<N>::kWeight + second.value_ * Message<M>::kWeight;
+        }
+    };
+
+    struct TernaryHandler {
+        template <size_t N, size_t M, size_t K>
+        uint64_t operator()(const Message<N>& first, const Message<M>& second, const Message<K>& third) const noexcept {
+            return first.value_ * Message<N>::kWeight + second.value_ * Message<M>::kWeight - third.value_ * Message<K>::kWeight;
+        }
+    };
+
+    template <typename Variants>
+    void MeasureVisitAndCompare(const std::string& prefix, const Variants& messages) {
+        uint64_t sum = 0;
+        Measure((prefix + ", Visit").c_str(), kVariantsCount, [&] {
+            for (const auto& message : messages) {
+                sum += cpp::variant::Visit(Handler{}, message);
+            }
+        });
+        size_t equal_count = 0;
+        Measure((prefix + ", operator==").c_str(), kVariantsCount - 1, [&] {
+            for (size_t i = 0; i + 1 < kVariantsCount; i++) {
+                equal_count += messages[i] == messages[i + 1];
+            }
+        });
+        std::cout << "Sum: " << sum << " " << equal_count << std::endl;
+    }
+
+    void BenchmarkNeverValueless() {
+        constexpr size_t kAlternativesCount = 8;
+        auto messages = MakeMessages<kAlternativesCount>(std::make_index_sequence<kAlternativesCount>());
+        // Grouped alternatives keep the branches predictable, so the cost of the checks is not hidden by mispredictions
+        std::stable_sort(messages.begin(), messages.end(), [](const auto& first, const auto& second) {
+            return first.Index() < second.Index();
+        });
+        std::vector<NeverValuelessMessageVariant<kAlternativesCount>> never_valueless_messages;
+        never_valueless_messages.reserve(kVariantsCount);
+        for (const auto& message : messages) {
+            never_valueless_messages.push_back(cpp::variant::Visit([](auto value) {
+                return NeverValuelessMessageVariant<kAlternativesCount>(value);
+            }, message));
+        }
+
+        MeasureVisitAndCompare("8 alternatives, Variant", messages);
+        MeasureVisitAndCompare("8 alternatives, NeverValuelessVariant", never_valueless_messages);
+    }
+
+    void BenchmarkMultiVisit() {
+        constexpr size_t kAlternativesCount = 12;
+        const auto messages = MakeMessages<kAlternativesCount>(std::make_index_sequence<kAlternativesCount>());
+
+        uint64_t sum = 0;
+        Measure("12x12 alternatives, Visit", kVariantsCount - 1, [&] {
+            for (size_t i = 0; i + 1 < kVariantsCount; i++) {
+                sum += cpp::variant::Visit(BinaryHandler{}, messages[i], messages[i + 1]);
+            }
+        });
+        Measure("12x12 alternatives, function pointer table", kVariantsCount - 1, [&] {
+            for (size_t i = 0; i + 1 < kVariantsCount; i++) {
+                sum -= cpp::variant::details::TableVisit(BinaryHandler{}, messages[i], messages[i + 1]);
+            }
+        });
+        Measure("12x12x12 alternatives, Visit<uint64_t>", kVariantsCount - 2, [&] {
+            for (size_t i = 0; i + 2 < kVariantsCount; i++) {
+                sum += cpp::variant::Visit<uint64_t>(TernaryHandler{}, messages[i], messages[i + 1], messages[i + 2]);
+            }
+        });
+        std::cout << "Sum: " << sum << std::endl;
+    }
+
+    struct Point {
+        float x_;
+        float y_;
+    };
+
+    using TrivialVariant = cpp::variant::Variant<int32_t, float, Point>;
+
+    // The targets hold random alternatives, so a branch on the current index is mispredicted
+    void BenchmarkAssign() {
+        std::mt19937 generator{42};
+        std::vector<TrivialVariant> targets;
+        targets.reserve(kVariantsCount);
+        for (size_t i = 0; i < kVariantsCount; i++) {
+            switch (generator() % 3) {
+                case 0: targets.emplace_back(static_cast<int32_t>(i)); break;
+                case 1: targets.emplace_back(static_cast<float>(i)); break;
+                default: targets.emplace_back(Point{1, 2}); break;
+            }
+        }
+        const std::vector<TrivialVariant> sources = targets;
+
+        Measure("Trivially copyable Variant, operator=(int32_t)", kVariantsCount, [&] {
+            for (size_t i = 0; i < kVariantsCount; i++) {
+                targets[i] = static_cast<int32_t>(i);
+            }
+        });
+        targets = sources;
+        Measure("Trivially copyable Variant, Emplace<Point>", kVariantsCount, [&] {
+            for (size_t i = 0; i < kVariantsCount; i++) {
+                targets[i].Emplace<Point>(static_cast<float>(i), 1.0f);
+            }
+        });
+        Measure("Trivially copyable Variant, copy assignment", kVariantsCount, [&] {
+            for (size_t i = 0; i < kVariantsCount; i++) {
+                targets[i] = sources[i];
+            }
+        });
+
+        float sum = 0;
+        for (const auto& target : targets) {
+            sum += target.Index();
+        }
+        std::cout << "Sum: " << sum << std::endl;
+    }
+
+    namespace instructions {
+
+        struct Push {
+            uint64_t value_;
+        };
+
+        struct Add {};
+
+        struct Mul {};
+
+        struct Xor {};
+
+        struct Dup {};
+
+        struct Drop {};
+
+    } // End of namespace instructions
+
+    using Instruction = cpp::variant::Variant<instructions::Push, instructions::Add, instructions::Mul,
+                                              instructions::Xor, instructions::Dup, instructions::Drop>;
+
+    using StdInstruction = std::variant<instructions::Push, instructions::Add, instructions::Mul,
+                                        instructions::Xor, instructions::Dup, instructions::Drop>;
+
+    constexpr size_t kStackCapacity = 64;
+
+    // Body of a loop of a stack machine repeated until the program has the given size.
+    // Half of the instructions of the body are pushes, and the stack is empty after every iteration.
+    template <typename I>
+    std::vector<I> MakeProgram(size_t size, size_t body_size) {
+        std::mt19937 generator{42};
+        std::vector<I> body;
+        size_t depth = 0;
+        for (size_t i = 0; i < body_size; i++) {
+            const uint32_t choice = generator() % 10;
+            if (depth < 2 || (choice < 5 && depth < kStackCapacity)) {
+                body.emplace_back(instructions::Push{generator()});
+                depth++;
+            } else if (choice < 6 && depth < kStackCapacity) {
+                body.emplace_back(instructions::Dup{});
+                depth++;
+            } else if (choice < 7) {
+                body.emplace_back(instructions::Drop{});
+                depth--;
+            } else {
+                switch (choice) {
+                    case 7: body.emplace_back(instructions::Add{}); break;
+                    case 8: body.emplace_back(instructions::Mul{}); break;
+                    default: body.emplace_back(instructions::Xor{}); break;
+                }
+                depth--;
+            }
+        }
+        for (; depth > 0; depth--) {
+            body.emplace_back(instructions::Drop{});
+        }
+
+        std::vector<I> program;
+        program.reserve(size);
+        while (program.size() < size) {
+            program.insert(program.end(), body.begin(), body.end());
+        }
+        program.resize(size);
+        return program;
+    }
+
+    struct Machine {
+        uint64_t stack_[kStackCapacity];
+        size_t size_ = 0;
+
+        void operator()(instructions::Push push) noexcept {
+            stack_[size_++] = push.value_;
+        }
+
+        void operator()(instructions::Add) noexcept {
+            size_--;
+            stack_[size_ - 1] += stack_[size_];
+        }
+
+        void operator()(instructions::Mul) noexcept {
+            size_--;
+            stack_[size_ - 1] *= stack_[size_];
+        }
+
+        void operator()(instructions::Xor) noexcept {
+            size_--;
+            stack_[size_ - 1] ^= stack_[size_];
+        }
+
+        void operator()(instructions::Dup) noexcept {
+            stack_[size_] = stack_[size_ - 1];
+            size_++;
+        }
+
+        void operator()(instructions::Drop) noexcept {
+            size_--;
+        }
+    };
+
+    void BenchmarkInterpreter(size_t body_size) {
+        const auto program = MakeProgram<Instruction>(kVariantsCount, body_size);
+        const auto std_program = MakeProgram<StdInstruction>(kVariantsCount, body_size);
+        const std::string prefix = "Interpreter, loop of " + std::to_string(body_size) + " instructions, ";
+
+        Machine visit_machine;
+        Measure((prefix + "Visit").c_str(), kVariantsCount, [&] {
+            for (const auto& instruction : program) {
+                cpp::variant::Visit(visit_machine, instruction);
+            }
+        });
+
+        Machine std_machine;
+        Measure((prefix + "std::visit").c_str(), kVariantsCount, [&] {
+            for (const auto& instruction : std_program) {
+                std::visit(std_machine, instruction);
+            }
+        });
+
+        Machine table_machine;
+        Measure((prefix + "function pointer table").c_str(), kVariantsCount, [&] {
+            for (const auto& instruction : program) {
+                cpp::variant::details::TableVisit(table_machine, instruction);
+            }
+        });
+
+        uint64_t stack[kStackCapacity];
+        size_t size = 0;
+        const auto pop = [&stack, &size] {
+            return stack[--size];
+        };
+        const auto run = [&](auto&& match) {
+            for (const auto& instruction : program) {
+                match(instruction,
+                      [&](instructions::Push push) { stack[size++] = push.value_; },
+                      [&](instructions::Add) { const uint64_t value = pop(); stack[size - 1] += value; },
+                      [&](instructions::Mul) { const uint64_t value = pop(); stack[size - 1] *= value; },
+                      [&](instructions::Xor) { const uint64_t value = pop(); stack[size - 1] ^= value; },
+                      [&](instructions::Dup) { stack[size] = stack[size - 1]; size++; },
+                      [&](instructions::Drop) { size--; });
+            }
+        };
+        Measure((prefix + "Match").c_str(), kVariantsCount, [&] {
+            run([](const Instruction& instruction, auto&&... functions) {
+                cpp::variant::Match(instruction, functions...);
+            });
+        });
+        const uint64_t match_top = stack[0];
+        size = 0;
+        Measure((prefix + "MatchLikely<Push>").c_str(), kVariantsCount, [&] {
+            run([](const Instruction& instruction, auto&&... functions) {
+                cpp::variant::MatchLikely<0>(instruction, functions...);
+            });
+        });
+        std::cout << "Top: " << visit_machine.stack_[0] << " " << std_machine.stack_[0] << " "
+                  << table_machine.stack_[0] << " " << match_top << " " << stack[0] << std::endl;
+    }
+
+    constexpr size_t kMapKeysCount = 1'000'000;
+
+    template <typename Key>
+    std::vector<Key> MakeKeys(size_t count, uint64_t seed) {
+        std::mt19937_64 generator{seed};
+        std::vector<Key> keys;
+        keys.reserve(count);
+        for (size_t i = 0; i < count; i++) {
+            const uint64_t value = generator() % (kMapKeysCount * 2);
+            switch (generator() % 3) {
+                case 0: keys.emplace_back(static_cast<int64_t>(value)); break;
+                case 1: keys.emplace_back(static_cast<double>(value)); break;
+                default: keys.emplace_back(static_cast<uint32_t>(value)); break;
+            }
+        }
+        return keys;
+    }
+
+    template <typename Key>
+    void BenchmarkVariantKeys(const std::string& name) {
+        const auto inserted = MakeKeys<Key>(kMapKeysCount, 42);
+        const auto lookups = MakeKeys<Key>(kVariantsCount, 7);
+
+        std::unordered_map<Key, uint64_t> map;
+        Measure((name + ", unordered_map insert").c_str(), kMapKeysCount, [&] {
+            for (size_t i = 0; i < kMapKeysCount; i++) {
+                map.emplace(inserted[i], i);
+            }
+        });
+        uint64_t sum = 0;
+        Measure((name + ", unordered_map find").c_str(), kVariantsCount, [&] {
+            for (const auto& key : lookups) {
+                if (const auto it = map.find(key); it != map.end()) {
+                    sum += it->second;
+                }
+            }
+        });
+        auto sorted = inserted;
+        Measure((name + ", sort").c_str(), kMapKeysCount, [&] {
+            std::sort(sorted.begin(), sorted.end());
+        });
+        std::cout << "Sum: " << sum << std::endl;
+    }
+
+    void BenchmarkHashMap() {
+        BenchmarkVariantKeys<cpp::variant::Variant<int64_t, double, uint32_t>>("Variant keys");
+        BenchmarkVariantKeys<std::variant<int64_t, double, uint32_t>>("std::variant keys");
+    }
+
+    constexpr size_t kScannedVariantsCount = 100'000'000;
+
+    using SmallVariant = cpp::variant::Variant<int8_t, bool>;
+
+    // The previous layout of SmallVariant with a size_t index
+    struct WideSmallVariant {
+        union {
+            int8_t number;
+            bool flag;
+        };
+        size_t index;
+    };
+
+    void BenchmarkScan() {
+        // Alternatives change in runs, so the scan is bound by the memory bandwidth rather than by mispredictions
+        constexpr size_t kRunLength = 1024;
+        std::mt19937 generator{42};
+        std::vector<uint8_t> alternatives(kScannedVariantsCount);
+        for (size_t i = 0; i < kScannedVariantsCount; i += kRunLength) {
+            const auto alternative = static_cast<uint8_t>(generator() % 2);
+            std::fill(alternatives.begin() + i, alternatives.begin() + std::min(i + kRunLength, kScannedVariantsCount), alternative);
+        }
+
+        {
+            std::vector<SmallVariant> variants;
+            variants.reserve(kScannedVariantsCount);
+            for (size_t i = 0; i < kScannedVariantsCount; i++) {
+                if (alternatives[i] == 0) {
+                    variants.emplace_back(static_cast<int8_t>(i));
+                } else {
+                    variants.emplace_back(i % 3 == 0);
+                }
+            }
+            std::cout << "sizeof(Variant<int8_t, bool>): " << sizeof(SmallVariant) << std::endl;
+
+            // Read the same way as the wide layout below, so only the size of the layouts differs
+            using cpp::variant::details::VariantAccess;
+            int64_t sum = 0;
+            Measure("Scan of Variant<int8_t, bool>", kScannedVariantsCount, [&] {
+                for (const auto& variant : variants) {
+                    sum += variant.Index() == 0 ? static_cast<int64_t>(VariantAccess::Get<0>(variant))
+                                                : static_cast<int64_t>(VariantAccess::Get<1>(variant));
+                }
+            });
+            std::cout << "Sum: " << sum << std::endl;
+        }
+
+        {
+            std::vector<WideSmallVariant> variants;
+            variants.reserve(kScannedVariantsCount);
+            for (size_t i = 0; i < kScannedVariantsCount; i++) {
+                WideSmallVariant variant{};
+                variant.index = alternatives[i];
+                if (alternatives[i] == 0) {
+                    variant.number = static_cast<int8_t>(i);
+                } else {
+                    variant.flag = i % 3 == 0;
+                }
+                variants.push_back(variant);
+            }
+            std::cout << "sizeof with a size_t index: " << sizeof(WideSmallVariant) << std::endl;
+
+            int64_t sum = 0;
+            Measure("Scan with a size_t index", kScannedVariantsCount, [&] {
+                for (const auto& variant : variants) {
+                    sum += variant.index == 0 ? static_cast<int64_t>(variant.number) : static_cast<int64_t>(variant.flag);
+                }
+            });
+            std::cout << "Sum: " << sum << std::endl;
+        }
+    }
+
+    // Alternatives of different sizes: the small ones are padded to the quote in a Variant
+    struct Quote {
+        double bid_;
+        double ask_;
+        double bid_size_;
+        double ask_size_;
+
+        bool operator==(const Quote&) const = default;
+    };
+
+    using Event = cpp::variant::Variant<Quote, double, uint32_t>;
+
+    struct EventValue {
+        double operator()(const Quote& quote) const noexcept {
+            return quote.bid_ * quote.bid_size_ + quote.ask_ * quote.ask_size_;
+        }
+
+        double operator()(double price) const noexcept {
+            return price;
+        }
+
+        double operator()(uint32_t count) const noexcept {
+            return static_cast<double>(count);
+        }
+    };
+
+    void BenchmarkVariantVector() {
+        std::mt19937 generator{42};
+        std::vector<Event> events;
+        events.reserve(kVariantsCount);
+        cpp::variant::VariantVector<Quote, double, uint32_t> event_vector;
+        event_vector.Reserve(kVariantsCount);
+        for (size_t i = 0; i < kVariantsCount; i++) {
+            const auto value = static_cast<double>(i % 1000);
+            const uint32_t kind = generator() % 10;
+            if (kind == 0) {
+                events.emplace_back(Quote{value, value + 1, 2, 3});
+            } else if (kind < 6) {
+                events.emplace_back(value);
+            } else {
+                events.emplace_back(static_cast<uint32_t>(i));
+            }
+            event_vector.PushBack(events.back());
+        }
+
+        const size_t vector_bytes = events.size() * sizeof(Event);
+        const size_t soa_bytes = event_vector.Size() * sizeof(cpp::variant::VariantVector<Quote, double, uint32_t>::IndexType) +
+                                 event_vector.Alternative<0>().size_bytes() +
+                                 event_vector.Alternative<1>().size_bytes() +
+                                 event_vector.Alternative<2>().size_bytes();
+        std::cout << "std::vector<Variant>: " << vector_bytes / (1024 * 1024) << " MiB, VariantVector: "
+                  << soa_bytes / (1024 * 1024) << " MiB" << std::endl;
+
+        double vector_sum = 0;
+        Measure("std::vector<Variant>, Visit", kVariantsCount, [&] {
+            for (const auto& event : events) {
+                vector_sum += cpp::variant::Visit(EventValue{}, event);
+            }
+        });
+
+        double soa_sum = 0;
+        Measure("VariantVector, VisitAll", kVariantsCount, [&] {
+            event_vector.VisitAll([&soa_sum](const auto& event) { soa_sum += EventValue{}(event); });
+        });
+
+        double ordered_sum = 0;
+        Measure("VariantVector, ForEach", kVariantsCount, [&] {
+            event_vector.ForEach([&ordered_sum](const auto& event) { ordered_sum += EventValue{}(event); });
+        });
+        std::cout << "Sum: " << vector_sum << " " << soa_sum << " " << ordered_sum << std::endl;
+    }
+
+
+    constexpr size_t kRecordsCount = 4'000'000;
+
+    // The throughput is counted in the bytes of the records in memory, so the encodings of different sizes are comparable
+    template <typename F>
+    void MeasureThroughput(const char* name, size_t bytes_count, F&& function) {
+        const auto start = std::chrono::steady_clock::now();
+        function();
+        const auto finish = std::chrono::steady_clock::now();
+        const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(finish - start).count();
+        std::cout << name << ": " << static_cast<double>(bytes_count) / static_cast<double>(elapsed) << " GB/s" << std::endl;
+    }
+
+    struct Trade {
+        uint64_t id_;
+        double price_;
+        uint32_t size_;
+
+        bool operator==(const Trade&) const = default;
+    };
+
+    using Record = cpp::variant::Variant<Quote, Trade, cpp::variant::Variant<int64_t, double>>;
+
+    std::vector<Record> MakeRecords() {
+        std::mt19937_64 generator{42};
+        std::vector<Record> records;
+        records.reserve(kRecordsCount);
+        for (size_t i = 0; i < kRecordsCount; i++) {
+            const double price = static_cast<double>(generator() % 10'000) / 100;
+            switch (generator() % 4) {
+                case 0: records.emplace_back(Quote{price, price + 0.01, 100, 200}); break;
+                case 1: records.emplace_back(Trade{i, price, static_cast<uint32_t>(generator() % 1'000)}); break;
+                case 2: records.emplace_back(cpp::variant::Variant<int64_t, double>{static_cast<int64_t>(i)}); break;
+                default: records.emplace_back(cpp::variant::Variant<int64_t, double>{price}); break;
+            }
+        }
+        return records;
+    }
+
+    // Serializer written by hand for the records: every field is appended and read back separately
+    namespace naive {
+
+        template <typename T>
+        void WriteField(std::vector<std::byte>& buffer, const T& field) {
+            const auto* bytes = reinterpret_cast<const std::byte*>(&field);
+            buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+        }
+
+        template <typename T>
+        T ReadField(const std::vector<std::byte>& buffer, size_t& offset) {
+            T field;
+            std::memcpy(&field, buffer.data() + offset, sizeof(T));
+            offset += sizeof(T);
+            return field;
+        }
+
+        struct RecordWriter {
+            std::vector<std::byte>& buffer_;
+
+            void operator()(const Quote& quote) const {
+                WriteField(buffer_, quote.bid_);
+                WriteField(buffer_, quote.ask_);
+                WriteField(buffer_, quote.bid_size_);
+                WriteField(buffer_, quote.ask_size_);
+            }
+
+            void operator()(const Trade& trade) const {
+                WriteField(buffer_, trade.id_);
+                WriteField(buffer_, trade.price_);
+                WriteField(buffer_, trade.size_);
+            }
+
+            void operator()(const cpp::variant::Variant<int64_t, double>& value) const {
+                WriteField(buffer_, value.Index());
+                cpp::variant::Visit([this](auto number) { WriteField(buffer_, number); }, value);
+            }
+        };
+
+        void Write(std::vector<std::byte>& buffer, const Record& record) {
+            WriteField(buffer, record.Index());
+            cpp::variant::Visit(RecordWriter{buffer}, record);
+        }
+
+        Record Read(const std::vector<std::byte>& buffer, size_t& offset) {
+            switch (ReadField<size_t>(buffer, offset)) {
+                case 0: {
+                    Quote quote{};
+                    quote.bid_ = ReadField<double>(buffer, offset);
+                    quote.ask_ = ReadField<double>(buffer, offset);
+                    quote.bid_size_ = ReadField<double>(buffer, offset);
+                    quote.ask_size_ = ReadField<double>(buffer, offset);
+                    return quote;
+                }
+                case 1: {
+                    Trade trade{};
+                    trade.id_ = ReadField<uint64_t>(buffer, offset);
+                    trade.price_ = ReadField<double>(buffer, offset);
+                    trade.size_ = ReadField<uint32_t>(buffer, offset);
+                    return trade;
+                }
+                default: {
+                    if (ReadField<size_t>(buffer, offset) == 0) {
+                        return cpp::variant::Variant<int64_t, double>{ReadField<int64_t>(buffer, offset)};
+                    }
+                    return cpp::variant::Variant<int64_t, double>{ReadField<double>(buffer, offset)};
+                }
+            }
+        }
+
+    } // End of namespace naive
+
+    struct EncodedRecordValue {
+        double operator()(const Quote& quote) const noexcept {
+            return quote.bid_;
+        }
+
+        double operator()(const Trade& trade) const noexcept {
+            return trade.price_;
+        }
+
+        double operator()(cpp::variant::EncodedVariant<int64_t, double> number) const {
+            return number.Visit([](auto value) { return static_cast<double>(value); });
+        }
+    };
+
+    void BenchmarkSerialization() {
+        const auto records = MakeRecords();
+
+        std::vector<std::byte> naive_buffer;
+        naive_buffer.reserve(kRecordsCount * (sizeof(size_t) + sizeof(Record)));
+        MeasureThroughput("Naive serializer, encode", kRecordsCount * sizeof(Record), [&] {
+            for (const auto& record : records) {
+                naive::Write(naive_buffer, record);
+            }
+        });
+
+        std::vector<std::byte> buffer;
+        buffer.reserve(kRecordsCount * (sizeof(size_t) + sizeof(Record)));
+        MeasureThroughput("Serialize, encode", kRecordsCount * sizeof(Record), [&] {
+            for (const auto& record : records) {
+                cpp::Serialize(record, buffer);
+            }
+        });
+        std::cout << "Encoded size: " << naive_buffer.size() / (1 << 20) << " MiB naive, "
+                  << buffer.size() / (1 << 20) << " MiB Serialize" << std::endl;
+
+        std::vector<Record> naive_records;
+        naive_records.reserve(kRecordsCount);
+        MeasureThroughput("Naive serializer, decode", kRecordsCount * sizeof(Record), [&] {
+            for (size_t offset = 0; offset < naive_buffer.size();) {
+                naive_records.push_back(naive::Read(naive_buffer, offset));
+            }
+        });
+
+        std::vector<Record> decoded_records;
+        decoded_records.reserve(kRecordsCount);
+        MeasureThroughput("EncodedReader, decode", kRecordsCount * sizeof(Record), [&] {
+            for (cpp::EncodedReader<Record> reader(buffer); !reader.IsEmpty();) {
+                decoded_records.push_back(reader.Next().Decode());
+            }
+        });
+
+        double sum = 0;
+        MeasureThroughput("EncodedReader, Visit without decoding", kRecordsCount * sizeof(Record), [&] {
+            for (cpp::EncodedReader<Record> reader(buffer); !reader.IsEmpty();) {
+                sum += reader.Next().Visit(EncodedRecordValue{});
+            }
+        });
+        std::cout << "Decoded: " << (naive_records == records) << " " << (decoded_records == records) << " " << sum << std::endl;
+    }
+
+} // End of namespace
+
+int main() {
+    BenchmarkVisit<2>();
+    BenchmarkVisit<4>();
+    BenchmarkVisit<8>();
+    BenchmarkVisit<16>();
+    BenchmarkVisit<64>();
+    BenchmarkNeverValueless();
+    BenchmarkMultiVisit();
+    BenchmarkAssign();
+    BenchmarkInterpreter(32);
+    BenchmarkInterpreter(kVariantsCount);
+    BenchmarkScan();
+    BenchmarkHashMap();
+    BenchmarkVariantVector();
+    BenchmarkSerialization();
+    return 0;
+}
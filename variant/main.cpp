@@ -1,6 +1,23 @@
 #include <iostream>
 #include <cassert>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
 #include "variant.h"
+#include "variant_vector.h"
+#include "variant_never_valueless.h"
+#include "variant_serialization.h"
+#include "optional/optional_serialization.h"
+
+struct Node {
+    int value_;
+};
+
+// Variants of Node* never hold the null pointer
+template <>
+struct cpp::NicheTraits<Node*> : cpp::NonNullNicheTraits<Node> {};
 
 namespace {
     constexpr void SimpleTest() {
@@ -9,9 +26,218 @@ namespace {
         variant = 5;
         assert(variant.Index() == 0);
     }
+
+    constexpr int VisitTest() {
+        cpp::variant::Variant<int, double, char> number{2.5};
+        cpp::variant::Variant<int, double, char> other{7};
+        return cpp::variant::Visit([](auto first, auto second) { return static_cast<int>(first + second); }, number, other);
+    }
+
+    static_assert(VisitTest() == 9);
+
+    constexpr int MatchTest() {
+        cpp::variant::Variant<int, double, bool> variant{2.5};
+        const auto match = [&variant] {
+            return cpp::variant::Match(variant,
+                                       [](int value) { return value; },
+                                       [](double value) { return static_cast<int>(value * 2); },
+                                       [](bool value) { return value ? 1 : 0; });
+        };
+        const int result = match();
+        variant = true;
+        return result + match() + cpp::variant::MatchLikely<2>(variant, [](auto value) { return static_cast<int>(value); });
+    }
+
+    static_assert(MatchTest() == 7);
+
+    struct Point {
+        int x_;
+        int y_;
+    };
+
+    // Emplace and assignment of trivially copyable alternatives are usable in constant evaluation
+    constexpr int EmplaceTest() {
+        cpp::variant::Variant<int, double, Point> variant{2.5};
+        variant.Emplace<Point>(3, 4);
+        const int sum = cpp::variant::Get<2>(variant).x_ + cpp::variant::Get<2>(variant).y_;
+        variant = 5;
+        return sum + cpp::variant::Get<0>(variant);
+    }
+
+    static_assert(EmplaceTest() == 12);
+
+    // Const alternatives can not be assigned, so they are destroyed and constructed again
+    constexpr int ConstEmplaceTest() {
+        cpp::variant::Variant<const int, float> variant{1.5f};
+        variant.Emplace<0>(3);
+        return cpp::variant::Get<0>(variant);
+    }
+
+    static_assert(ConstEmplaceTest() == 3);
+
+    // The index takes the smallest type that fits the alternatives
+    static_assert(sizeof(cpp::variant::Variant<int8_t, bool>) == 2);
+    static_assert(sizeof(cpp::variant::Variant<int16_t, char>) == 4);
+    static_assert(sizeof(cpp::variant::Variant<int, float>) == 8);
+    static_assert(sizeof(cpp::variant::Variant<double, int>) == 16);
+
+    // A pointer with niches and an empty alternative are stored as the pointer, the empty alternative is a niche value
+    struct Empty {};
+
+    static_assert(sizeof(cpp::variant::Variant<Node*, Empty>) == sizeof(Node*));
+    static_assert(sizeof(cpp::variant::Variant<int*, Empty>) > sizeof(int*));
+
+    void NicheTest() {
+        Node node{5};
+        cpp::variant::Variant<Empty, Node*> variant{};
+        assert(variant.Index() == 0);
+        variant = &node;
+        assert(cpp::variant::Get<1>(variant)->value_ == 5);
+        variant = Empty{};
+        assert(variant.Index() == 0);
+
+        // Pointers without niches hold the null pointer as a value
+        cpp::variant::Variant<Empty, int*> plain{};
+        plain = nullptr;
+        assert(plain.Index() == 1);
+    }
+
+    struct Thrower {
+        Thrower() = default;
+
+        explicit Thrower(int) {
+            throw std::runtime_error("Thrower");
+        }
+    };
+
+    void ValuelessAssignTest() {
+        cpp::variant::Variant<std::string, Thrower> valueless{std::string("value")};
+        try {
+            valueless.Emplace<1>(0);
+        } catch (const std::runtime_error&) {}
+        assert(valueless.ValuelessByException());
+
+        // Assigning a valueless variant makes the target valueless
+        cpp::variant::Variant<std::string, Thrower> variant{std::string("other")};
+        variant = valueless;
+        assert(variant.ValuelessByException());
+        variant = std::string("other");
+        variant = std::move(valueless);
+        assert(variant.ValuelessByException());
+    }
+
+    void NeverValuelessTest() {
+        cpp::variant::NeverValuelessVariant<int, std::string> variant{std::string("value")};
+        assert(variant.Index() == 1);
+        variant = 42;
+        assert(cpp::variant::Get<int>(variant) == 42);
+        static_assert(!cpp::variant::NeverValuelessVariant<int, std::string>::ValuelessByException());
+    }
+
+    static_assert(std::is_trivially_copyable_v<cpp::variant::NeverValuelessVariant<int, double>>);
+
+    void VariantVectorTest() {
+        cpp::variant::VariantVector<int, double, char> values;
+        values.PushBack(1);
+        values.PushBack(2.5);
+        values.PushBack('a');
+        values.PushBack(cpp::variant::Variant<int, double, char>{3});
+        assert(values.Size() == 4);
+        assert(values.Index(1) == 1);
+        assert(values.Alternative<0>().size() == 2);
+
+        double sum = 0;
+        values.VisitAll([&sum](auto value) { sum += value; });
+        assert(sum == 1 + 2.5 + 'a' + 3);
+
+        size_t position = 0;
+        values.ForEach([&values, &position](const auto& value) {
+            using T = std::remove_cvref_t<decltype(value)>;
+            [[maybe_unused]] constexpr size_t kIndex = cpp::variant::details::kFindInPackValue<T, int, double, char>;
+            assert(values.Index(position) == kIndex);
+            position++;
+        });
+        assert(position == values.Size());
+
+        // bool values are stored one per byte, so they are accessed by reference as the other alternatives
+        cpp::variant::VariantVector<int, bool> flags;
+        flags.PushBack(1);
+        flags.Emplace<1>(false) = true;
+        for (int i = 0; i < 40; i++) {
+            flags.PushBack(i % 2 == 0);
+        }
+        assert(flags.Alternative<1>().size() == 41);
+        flags.VisitAll([](auto& value) { value = !value; });
+        assert(flags.Alternative<0>()[0] == 0);
+        assert(!flags.Alternative<1>()[0] && !flags.Alternative<1>()[1] && flags.Alternative<1>()[2]);
+        size_t true_count = 0;
+        std::as_const(flags).ForEach([&true_count](const auto& value) {
+            if constexpr (std::is_same_v<std::remove_cvref_t<decltype(value)>, bool>) {
+                true_count += value;
+            }
+        });
+        assert(true_count == 20);
+    }
+
+    void HashTest() {
+        using Key = cpp::variant::Variant<int, unsigned, std::string>;
+        std::unordered_map<Key, int> map;
+        map[Key{1}] = 1;
+        map[Key{1u}] = 2;
+        map[Key{std::string("key")}] = 3;
+        assert(map.size() == 3);
+        assert(map.at(Key{1}) == 1);
+        assert(map.at(Key{1u}) == 2);
+        assert(Key{1} < Key{1u});
+    }
+
+    void SerializationTest() {
+        using Number = cpp::variant::Variant<int32_t, double>;
+        using Value = cpp::variant::Variant<Number, char>;
+        std::vector<std::byte> buffer;
+        cpp::Serialize(Value{Number{2.5}}, buffer);
+        cpp::Serialize(Value{'a'}, buffer);
+        assert(buffer.size() == 2 + sizeof(double) + 1 + 1);
+
+        double sum = 0;
+        for (cpp::EncodedReader<Value> reader(buffer); !reader.IsEmpty();) {
+            sum += reader.Next().Visit([](auto value) -> double {
+                if constexpr (std::is_same_v<decltype(value), char>) {
+                    return value;
+                } else {
+                    return value.Visit([](auto number) { return static_cast<double>(number); });
+                }
+            });
+        }
+        assert(sum == 2.5 + 'a');
+
+        cpp::EncodedReader<Value> reader(buffer);
+        assert(reader.Next().Decode() == Value{Number{2.5}});
+
+        // Optionals and variants share the encoding, so they are nested into each other
+        using Field = cpp::variant::Variant<int32_t, cpp::optional::Optional<int32_t>>;
+        using MaybeNumber = cpp::optional::Optional<cpp::variant::Variant<char, double>>;
+        buffer.clear();
+        cpp::Serialize(Field{cpp::optional::Optional<int32_t>{7}}, buffer);
+        cpp::Serialize(MaybeNumber{cpp::variant::Variant<char, double>{2.5}}, buffer);
+        assert(buffer.size() == 1 + 1 + sizeof(int32_t) + 1 + 1 + sizeof(double));
+
+        cpp::EncodedReader<Field> field_reader(buffer);
+        assert(field_reader.Next().Decode() == Field{cpp::optional::Optional<int32_t>{7}});
+        cpp::EncodedReader<MaybeNumber> number_reader(std::span<const std::byte>(buffer).subspan(1 + 1 + sizeof(int32_t)));
+        [[maybe_unused]] const auto number = number_reader.Next();
+        assert(number && (*number).Index() == 1);
+        assert(cpp::variant::Get<1>(*number.Decode()) == 2.5);
+    }
 }
 
 int main() {
     SimpleTest();
+    NicheTest();
+    ValuelessAssignTest();
+    NeverValuelessTest();
+    VariantVectorTest();
+    HashTest();
+    SerializationTest();
     return 0;
 }
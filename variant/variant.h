@@ -1,6 +1,7 @@
 #ifndef CPP_IMPLEMENTATIONS_VARIANT_H
 #define CPP_IMPLEMENTATIONS_VARIANT_H
 
+#include <functional>
 #include "variant_storage.h"
 
 namespace cpp::variant {
@@ -24,7 +25,10 @@ namespace cpp::variant {
         template <typename T, typename ChosenTypeInfo = details::ChosenOverload<T, Ts...>, typename ChosenT = typename ChosenTypeInfo::Type, size_t Index = ChosenTypeInfo::index>
         constexpr Variant& operator=(T&& t) noexcept(std::is_nothrow_assignable_v<ChosenT&, T> && std::is_nothrow_constructible_v<ChosenT, T>)
         requires details::IsConvertibleToChosenTypeVariant<Variant, T, ChosenT, Ts...> {
-            if (this->Index() == Index) {
+            if constexpr (details::IsTriviallyReplaceable<Ts...> && std::is_same_v<std::remove_cvref_t<T>, ChosenT>) {
+                // Trivial assignment and reconstruction are the same, so the index is not checked
+                Base::AssignInternalValue(kInPlaceIndex<Index>, std::forward<T>(t));
+            } else if (this->Index() == Index) {
                 Get<Index>(*this) = std::forward<T>(t);
             } else if (std::is_nothrow_constructible_v<ChosenT, T> || !std::is_nothrow_move_constructible_v<ChosenT>) {
                 Emplace<Index>(std::forward<T>(t));
@@ -58,6 +62,7 @@ namespace cpp::variant {
                 } else {
                     this->DestroyInternalValue();
                     this->MakeValueless();
+                    return *this;
                 }
             }
             details::VisitIndex(
@@ -139,9 +144,13 @@ namespace cpp::variant {
         constexpr T_N& Emplace(Args&&... args) requires(std::is_constructible_v<T_N, Args...>) {
             static_assert(N < sizeof...(Ts));
 
-            Base::DestroyInternalValue();
-            this->MakeValueless();
-            return Base::ConstructInternalValue(kInPlaceIndex<N>, std::forward<Args>(args)...);
+            if constexpr (details::IsTriviallyReplaceable<Ts...>) {
+                return Base::AssignInternalValue(kInPlaceIndex<N>, std::forward<Args>(args)...);
+            } else {
+                Base::DestroyInternalValue();
+                this->MakeValueless();
+                return Base::ConstructInternalValue(kInPlaceIndex<N>, std::forward<Args>(args)...);
+            }
         }
 
         template <typename T, typename... Args, size_t Index = details::kFindInPackValue<T, Ts...>>
@@ -158,7 +167,6 @@ namespace cpp::variant {
                         [this, &other](auto ind_) {
                             using std::swap;
                             swap(Get<ind_()>(*this), Get<ind_()>(other));
-                            swap(this->ind, other.ind);
                         },
                         other);
             } else {
@@ -172,11 +180,11 @@ namespace cpp::variant {
         }
 
         [[nodiscard]] constexpr size_t Index() const noexcept {
-            return this->ind;
+            return Base::StoredIndex();
         }
 
         constexpr void MakeValueless() noexcept {
-            this->ind = kVariantNPos;
+            Base::StoreValueless();
         }
 
         constexpr ~Variant() = default;
@@ -196,6 +204,8 @@ namespace cpp::variant {
         template <bool TriviallyDestructible, typename... Ts_>
         friend struct details::VariantStorage;
 
+        friend struct details::VariantAccess;
+
     };
 
     template <typename... Ts>
@@ -206,7 +216,11 @@ namespace cpp::variant {
         if (v.ValuelessByException()) {
             return true;
         }
-        return details::VisitIndex([&v, &w](auto ind_) -> bool { return Get<ind_()>(v) == Get<ind_()>(w); }, v);
+        bool result = false;
+        details::InlineDispatch<sizeof...(Ts)>(v.Index(), [&v, &w, &result](auto ind_) {
+            result = details::VariantAccess::Get<ind_()>(v) == details::VariantAccess::Get<ind_()>(w);
+        });
+        return result;
     }
 
     template <typename... Ts>
@@ -214,25 +228,20 @@ namespace cpp::variant {
         return !(v == w);
     }
 
+    // The valueless state is the smallest, its index kVariantNPos is converted to the largest size_t
     template <typename... Ts>
     constexpr bool operator<(const Variant<Ts...>& v, const Variant<Ts...>& w) noexcept {
-        if (w.ValuelessByException()) {
-            return false;
+        if (v.Index() != w.Index()) {
+            return v.Index() + 1 < w.Index() + 1;
         }
         if (v.ValuelessByException()) {
-            return true;
+            return false;
         }
-        return details::VisitIndex(
-                [&v, &w](auto ind1, auto ind2) -> bool {
-                    if (ind1() < ind2()) {
-                        return true;
-                    }
-                    if (ind1() > ind2()) {
-                        return false;
-                    }
-                    return Get<ind1()>(v) < Get<ind1()>(w);
-                },
-                v, w);
+        bool result = false;
+        details::InlineDispatch<sizeof...(Ts)>(v.Index(), [&v, &w, &result](auto ind_) {
+            result = details::VariantAccess::Get<ind_()>(v) < details::VariantAccess::Get<ind_()>(w);
+        });
+        return result;
     }
 
     template <typename... Ts>
@@ -252,4 +261,21 @@ namespace cpp::variant {
 
 } // End of namespace cpp::variant
 
+// Combines the index with the hash of the alternative, so equal values of different alternatives differ
+template <typename... Ts>
+requires (std::is_default_constructible_v<std::hash<std::remove_const_t<Ts>>> && ...)
+struct std::hash<cpp::variant::Variant<Ts...>> {
+    size_t operator()(const cpp::variant::Variant<Ts...>& variant) const noexcept {
+        if (variant.ValuelessByException()) {
+            return static_cast<size_t>(0x9E3779B97F4A7C15ull);
+        }
+        size_t hash = 0;
+        cpp::variant::details::InlineDispatch<sizeof...(Ts)>(variant.Index(), [&variant, &hash](auto ind_) {
+            using Alternative = std::remove_const_t<cpp::variant::details::At<ind_(), Ts...>>;
+            hash = std::hash<Alternative>()(cpp::variant::details::VariantAccess::Get<ind_()>(variant));
+        });
+        return hash ^ (variant.Index() + static_cast<size_t>(0x9E3779B97F4A7C15ull) + (hash << 6) + (hash >> 2));
+    }
+};
+
 #endif //CPP_IMPLEMENTATIONS_VARIANT_H
@@ -1,6 +1,7 @@
 #ifndef CPP_IMPLEMENTATIONS_VARIANT_CONSTRAINTS_H
 #define CPP_IMPLEMENTATIONS_VARIANT_CONSTRAINTS_H
 
+#include <cstddef>
 #include <cstdint>
 #include <type_traits>
 #include <utility>
@@ -73,6 +74,14 @@ namespace cpp::variant {
         template <typename... Ts>
         concept IsTriviallyDestructible = (std::is_trivially_destructible_v<Ts> && ...);
 
+        template <typename... Ts>
+        concept IsTriviallyCopyable = (std::is_trivially_copyable_v<Ts> && ...);
+
+        // The new value can be built aside and copied over the whole storage. Const alternatives are excluded,
+        // the copy assignment of a union with such a member is deleted.
+        template <typename... Ts>
+        concept IsTriviallyReplaceable = IsTriviallyCopyable<Ts...> && (std::is_trivially_copy_assignable_v<Ts> && ...);
+
         template <typename... Ts>
         concept IsTriviallyCopyAssignable = IsCopyAssignable<Ts...> && IsTriviallyCopyConstructible<Ts...>
                 && (std::is_trivially_copy_assignable_v<Ts> && ...) && IsTriviallyDestructible<Ts...>;
@@ -0,0 +1,267 @@
+#ifndef CPP_IMPLEMENTATIONS_VARIANT_NEVER_VALUELESS_H
+#define CPP_IMPLEMENTATIONS_VARIANT_NEVER_VALUELESS_H
+
+#include <type_traits>
+#include <utility>
+#include "variant.h"
+
+namespace cpp::variant {
+
+    template <typename... Ts>
+    class NeverValuelessVariant;
+
+
+    namespace details {
+
+        template <typename... Ts>
+        inline constexpr size_t kNothrowFallbackIndex = [] {
+            constexpr bool kIsNothrowDefaultConstructible[] = {std::is_nothrow_default_constructible_v<Ts>...};
+            for (size_t i = 0; i < sizeof...(Ts); i++) {
+                if (kIsNothrowDefaultConstructible[i]) {
+                    return i;
+                }
+            }
+            return kVariantNPos;
+        }();
+
+        // A value that can not be built in a temporary and moved in without the risk of an exception
+        // is replaced with the first nothrow default constructible alternative when its constructor throws
+        template <typename... Ts>
+        concept IsNeverValuelessAllowed = (sizeof...(Ts) > 0)
+                && ((std::is_nothrow_move_constructible_v<Ts> && ...) || kNothrowFallbackIndex<Ts...> != kVariantNPos);
+
+    } // End of namespace cpp::variant::details
+
+
+    template <typename... Ts>
+    struct VariantSize<NeverValuelessVariant<Ts...>> : std::integral_constant<size_t, sizeof...(Ts)> {};
+
+    template <typename... Ts>
+    struct VariantSize<const NeverValuelessVariant<Ts...>> : std::integral_constant<size_t, sizeof...(Ts)> {};
+
+    template <size_t N, typename... Ts>
+    struct VariantAlternative<N, NeverValuelessVariant<Ts...>> {
+        using Type = details::At<N, Ts...>;
+    };
+
+    template <size_t N, typename... Ts>
+    struct VariantAlternative<N, const NeverValuelessVariant<Ts...>> {
+        using Type = const details::At<N, Ts...>;
+    };
+
+
+    // Variant that always holds a value. A throwing constructor of the new alternative runs on a temporary
+    // that is moved in afterwards, or, if the alternative may throw on move, the variant falls back
+    // to a nothrow default constructible alternative. ValuelessByException is a constant false,
+    // so Visit and the comparison operators have no valueless checks.
+    template <typename... Ts>
+    class NeverValuelessVariant : private Variant<Ts...> {
+        static_assert(details::IsNeverValuelessAllowed<Ts...>,
+                      "Alternatives that may throw on move require a nothrow default constructible alternative");
+
+    public:
+        using Base = Variant<Ts...>;
+
+        using Base::Base;
+        using Base::Index;
+
+        constexpr NeverValuelessVariant() = default;
+
+        constexpr NeverValuelessVariant(const NeverValuelessVariant&) = default;
+        constexpr NeverValuelessVariant(NeverValuelessVariant&&) = default;
+
+        constexpr NeverValuelessVariant& operator=(const NeverValuelessVariant& other) = delete;
+
+        constexpr NeverValuelessVariant& operator=(const NeverValuelessVariant& other) requires(details::IsCopyAssignable<Ts...>);
+
+        constexpr NeverValuelessVariant& operator=(const NeverValuelessVariant& other) requires(details::IsTriviallyCopyAssignable<Ts...>) = default;
+
+        constexpr NeverValuelessVariant& operator=(NeverValuelessVariant&& other) = delete;
+
+        constexpr NeverValuelessVariant& operator=(NeverValuelessVariant&& other) requires(details::IsMoveAssignable<Ts...>);
+
+        constexpr NeverValuelessVariant& operator=(NeverValuelessVariant&& other) requires(details::IsTriviallyMoveAssignable<Ts...>) = default;
+
+        template <typename T, typename ChosenTypeInfo = details::ChosenOverload<T, Ts...>, typename ChosenT = typename ChosenTypeInfo::Type, size_t Index = ChosenTypeInfo::index>
+        constexpr NeverValuelessVariant& operator=(T&& t)
+        requires details::IsConvertibleToChosenTypeVariant<NeverValuelessVariant, T, ChosenT, Ts...>;
+
+        template <size_t N, typename T_N = details::At<N, Ts...>, typename... Args>
+        constexpr T_N& Emplace(Args&&... args) requires(std::is_constructible_v<T_N, Args...>);
+
+        template <typename T, typename... Args, size_t Index = details::kFindInPackValue<T, Ts...>>
+        constexpr T& Emplace(Args&&... args) requires(std::is_constructible_v<T, Args...> && details::kOccursOnlyOnceValue<T, Ts...>);
+
+        constexpr void Swap(NeverValuelessVariant& other);
+
+        [[nodiscard]] static constexpr bool ValuelessByException() noexcept {
+            return false;
+        }
+
+        [[nodiscard]] constexpr const Base& AsVariant() const noexcept {
+            return *this;
+        }
+
+        friend struct details::VariantAccess;
+    };
+
+
+    // Implementation
+    template <typename... Ts>
+    constexpr NeverValuelessVariant<Ts...>& NeverValuelessVariant<Ts...>::operator=(const NeverValuelessVariant& other)
+    requires(details::IsCopyAssignable<Ts...>) {
+        details::VisitIndex([this, &other](auto ind_) {
+            if (Index() == ind_()) {
+                details::VariantAccess::Get<ind_()>(*this) = details::VariantAccess::Get<ind_()>(other);
+            } else {
+                Emplace<ind_()>(details::VariantAccess::Get<ind_()>(other));
+            }
+        }, other);
+        return *this;
+    }
+
+    template <typename... Ts>
+    constexpr NeverValuelessVariant<Ts...>& NeverValuelessVariant<Ts...>::operator=(NeverValuelessVariant&& other)
+    requires(details::IsMoveAssignable<Ts...>) {
+        details::VisitIndex([this, &other](auto ind_) {
+            if (Index() == ind_()) {
+                details::VariantAccess::Get<ind_()>(*this) = details::VariantAccess::Get<ind_()>(std::move(other));
+            } else {
+                Emplace<ind_()>(details::VariantAccess::Get<ind_()>(std::move(other)));
+            }
+        }, other);
+        return *this;
+    }
+
+    template <typename... Ts>
+    template <typename T, typename ChosenTypeInfo, typename ChosenT, size_t Index>
+    constexpr NeverValuelessVariant<Ts...>& NeverValuelessVariant<Ts...>::operator=(T&& t)
+    requires details::IsConvertibleToChosenTypeVariant<NeverValuelessVariant, T, ChosenT, Ts...> {
+        if (this->Index() == Index) {
+            details::VariantAccess::Get<Index>(*this) = std::forward<T>(t);
+        } else {
+            Emplace<Index>(std::forward<T>(t));
+        }
+        return *this;
+    }
+
+    template <typename... Ts>
+    template <size_t N, typename T_N, typename... Args>
+    constexpr T_N& NeverValuelessVariant<Ts...>::Emplace(Args&&... args) requires(std::is_constructible_v<T_N, Args...>) {
+        if constexpr (std::is_nothrow_constructible_v<T_N, Args...>) {
+            return Base::template Emplace<N>(std::forward<Args>(args)...);
+        } else if constexpr (std::is_nothrow_move_constructible_v<T_N>) {
+            T_N value(std::forward<Args>(args)...);
+            return Base::template Emplace<N>(std::move(value));
+        } else {
+            try {
+                return Base::template Emplace<N>(std::forward<Args>(args)...);
+            } catch (...) {
+                Base::template Emplace<details::kNothrowFallbackIndex<Ts...>>();
+                throw;
+            }
+        }
+    }
+
+    template <typename... Ts>
+    template <typename T, typename... Args, size_t Index>
+    constexpr T& NeverValuelessVariant<Ts...>::Emplace(Args&&... args)
+    requires(std::is_constructible_v<T, Args...> && details::kOccursOnlyOnceValue<T, Ts...>) {
+        return Emplace<Index, T>(std::forward<Args>(args)...);
+    }
+
+    template <typename... Ts>
+    constexpr void NeverValuelessVariant<Ts...>::Swap(NeverValuelessVariant& other) {
+        if (Index() == other.Index()) {
+            details::VisitIndex([this, &other](auto ind_) {
+                using std::swap;
+                swap(details::VariantAccess::Get<ind_()>(*this), details::VariantAccess::Get<ind_()>(other));
+            }, other);
+        } else {
+            NeverValuelessVariant temporary(std::move(other));
+            other = std::move(*this);
+            *this = std::move(temporary);
+        }
+    }
+
+    template <size_t N, typename... Ts>
+    constexpr VariantAlternativeType<N, NeverValuelessVariant<Ts...>>& Get(NeverValuelessVariant<Ts...>& v) {
+        if (N != v.Index()) {
+            throw BadVariantAccess("Variant stores alternative with another index");
+        }
+        return details::VariantAccess::Get<N>(v);
+    }
+
+    template <size_t N, typename... Ts>
+    constexpr const VariantAlternativeType<N, NeverValuelessVariant<Ts...>>& Get(const NeverValuelessVariant<Ts...>& v) {
+        if (N != v.Index()) {
+            throw BadVariantAccess("Variant stores alternative with another index");
+        }
+        return details::VariantAccess::Get<N>(v);
+    }
+
+    template <typename T, typename... Ts, size_t Index = details::kFindInPackValue<T, Ts...>>
+    constexpr T& Get(NeverValuelessVariant<Ts...>& v) requires(details::kOccursOnlyOnceValue<T, Ts...>) {
+        return Get<Index>(v);
+    }
+
+    template <typename T, typename... Ts, size_t Index = details::kFindInPackValue<T, Ts...>>
+    constexpr const T& Get(const NeverValuelessVariant<Ts...>& v) requires(details::kOccursOnlyOnceValue<T, Ts...>) {
+        return Get<Index>(v);
+    }
+
+    template <typename... Ts>
+    constexpr bool operator==(const NeverValuelessVariant<Ts...>& v, const NeverValuelessVariant<Ts...>& w) {
+        if (v.Index() != w.Index()) {
+            return false;
+        }
+        bool result = false;
+        details::InlineDispatch<sizeof...(Ts)>(v.Index(), [&v, &w, &result](auto ind_) {
+            result = details::VariantAccess::Get<ind_()>(v) == details::VariantAccess::Get<ind_()>(w);
+        });
+        return result;
+    }
+
+    template <typename... Ts>
+    constexpr bool operator!=(const NeverValuelessVariant<Ts...>& v, const NeverValuelessVariant<Ts...>& w) {
+        return !(v == w);
+    }
+
+    template <typename... Ts>
+    constexpr bool operator<(const NeverValuelessVariant<Ts...>& v, const NeverValuelessVariant<Ts...>& w) {
+        if (v.Index() != w.Index()) {
+            return v.Index() < w.Index();
+        }
+        bool result = false;
+        details::InlineDispatch<sizeof...(Ts)>(v.Index(), [&v, &w, &result](auto ind_) {
+            result = details::VariantAccess::Get<ind_()>(v) < details::VariantAccess::Get<ind_()>(w);
+        });
+        return result;
+    }
+
+    template <typename... Ts>
+    constexpr bool operator>(const NeverValuelessVariant<Ts...>& v, const NeverValuelessVariant<Ts...>& w) {
+        return w < v;
+    }
+
+    template <typename... Ts>
+    constexpr bool operator<=(const NeverValuelessVariant<Ts...>& v, const NeverValuelessVariant<Ts...>& w) {
+        return !(w < v);
+    }
+
+    template <typename... Ts>
+    constexpr bool operator>=(const NeverValuelessVariant<Ts...>& v, const NeverValuelessVariant<Ts...>& w) {
+        return !(v < w);
+    }
+
+} // End of namespace cpp::variant
+
+template <typename... Ts>
+requires (std::is_default_constructible_v<std::hash<cpp::variant::Variant<Ts...>>>)
+struct std::hash<cpp::variant::NeverValuelessVariant<Ts...>> {
+    size_t operator()(const cpp::variant::NeverValuelessVariant<Ts...>& variant) const noexcept {
+        return std::hash<cpp::variant::Variant<Ts...>>()(variant.AsVariant());
+    }
+};
+
+#endif //CPP_IMPLEMENTATIONS_VARIANT_NEVER_VALUELESS_H
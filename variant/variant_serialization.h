@@ -0,0 +1,119 @@
+#ifndef CPP_IMPLEMENTATIONS_VARIANT_SERIALIZATION_H
+#define CPP_IMPLEMENTATIONS_VARIANT_SERIALIZATION_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include "common/encoding.h"
+#include "variant.h"
+
+namespace cpp::variant {
+
+    // Encoded variant read in place. The values of the alternatives are copied out of the data
+    // only when they are visited, and nested variants are visited as EncodedVariant too.
+    template <typename... Ts>
+    class EncodedVariant {
+    public:
+        // The data must hold a checked encoding, as the values returned by EncodedReader
+        explicit EncodedVariant(const std::byte* data) noexcept : data_(data) {}
+
+        [[nodiscard]] size_t Index() const noexcept {
+            return std::to_integer<size_t>(*data_);
+        }
+
+        [[nodiscard]] const std::byte* Data() const noexcept {
+            return data_;
+        }
+
+        // Calls function with the EncodingTraits<T>::View of the alternative
+        template <typename F>
+        decltype(auto) Visit(F&& function) const;
+
+        [[nodiscard]] Variant<Ts...> Decode() const {
+            return EncodingTraits<Variant<Ts...>>::Read(data_);
+        }
+
+    private:
+        const std::byte* data_;
+    };
+
+} // End of namespace cpp::variant
+
+namespace cpp {
+
+    // A variant is stored as the index byte followed by the encoding of the alternative
+    template <typename... Ts>
+    struct EncodingTraits<variant::Variant<Ts...>> {
+        static_assert(sizeof...(Ts) <= UINT8_MAX, "The index of the alternative is stored in a byte");
+
+        using View = variant::EncodedVariant<Ts...>;
+
+        // Throws BadVariantAccess if the variant is valueless
+        static constexpr size_t Size(const variant::Variant<Ts...>& value);
+
+        static std::byte* Write(const variant::Variant<Ts...>& value, std::byte* data);
+
+        static size_t EncodedSize(const std::byte* data, size_t available);
+
+        static variant::Variant<Ts...> Read(const std::byte* data);
+
+        static View MakeView(const std::byte* data) noexcept {
+            return View(data);
+        }
+    };
+
+
+    // Implementation
+    template <typename... Ts>
+    constexpr size_t EncodingTraits<variant::Variant<Ts...>>::Size(const variant::Variant<Ts...>& value) {
+        if (value.ValuelessByException()) {
+            throw variant::BadVariantAccess("Valueless variant can not be serialized");
+        }
+        return variant::details::IndexDispatch<size_t, sizeof...(Ts)>(value.Index(), [&value](auto ind_) {
+            return 1 + EncodingTraits<variant::details::At<ind_(), Ts...>>::Size(variant::details::VariantAccess::Get<ind_()>(value));
+        });
+    }
+
+    template <typename... Ts>
+    std::byte* EncodingTraits<variant::Variant<Ts...>>::Write(const variant::Variant<Ts...>& value, std::byte* data) {
+        *data = static_cast<std::byte>(value.Index());
+        return variant::details::IndexDispatch<std::byte*, sizeof...(Ts)>(value.Index(), [&value, data](auto ind_) {
+            return EncodingTraits<variant::details::At<ind_(), Ts...>>::Write(variant::details::VariantAccess::Get<ind_()>(value), data + 1);
+        });
+    }
+
+    template <typename... Ts>
+    size_t EncodingTraits<variant::Variant<Ts...>>::EncodedSize(const std::byte* data, size_t available) {
+        if (available == 0 || std::to_integer<size_t>(*data) >= sizeof...(Ts)) {
+            throw BadEncoding("Encoded variant has an invalid index");
+        }
+        return variant::details::IndexDispatch<size_t, sizeof...(Ts)>(std::to_integer<size_t>(*data), [data, available](auto ind_) {
+            return 1 + EncodingTraits<variant::details::At<ind_(), Ts...>>::EncodedSize(data + 1, available - 1);
+        });
+    }
+
+    template <typename... Ts>
+    variant::Variant<Ts...> EncodingTraits<variant::Variant<Ts...>>::Read(const std::byte* data) {
+        return variant::details::IndexDispatch<variant::Variant<Ts...>, sizeof...(Ts)>(std::to_integer<size_t>(*data), [data](auto ind_) {
+            return variant::Variant<Ts...>(variant::kInPlaceIndex<ind_()>, EncodingTraits<variant::details::At<ind_(), Ts...>>::Read(data + 1));
+        });
+    }
+
+} // End of namespace cpp
+
+namespace cpp::variant {
+
+    template <typename... Ts>
+    template <typename F>
+    decltype(auto) EncodedVariant<Ts...>::Visit(F&& function) const {
+        using R = std::invoke_result_t<F, typename EncodingTraits<details::At<0, Ts...>>::View>;
+        return details::IndexDispatch<R, sizeof...(Ts)>(Index(), [this, &function](auto ind_) -> R {
+            return std::invoke(std::forward<F>(function), EncodingTraits<details::At<ind_(), Ts...>>::MakeView(data_ + 1));
+        });
+    }
+
+} // End of namespace cpp::variant
+
+#endif //CPP_IMPLEMENTATIONS_VARIANT_SERIALIZATION_H
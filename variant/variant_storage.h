@@ -2,8 +2,11 @@
 #define CPP_IMPLEMENTATIONS_VARIANT_STORAGE_H
 
 #include <cstdint>
+#include <limits>
+#include <memory>
 #include <utility>
 #include <type_traits>
+#include "common/niche_traits.h"
 #include "variant_constraints.h"
 #include "variant_utils.h"
 
@@ -19,6 +22,14 @@ namespace cpp::variant {
 
         inline constexpr UninitializedStorageTag kUninitializedStorageTag;
 
+        // The index is stored in the smallest signed type that fits all alternatives. The valueless state is -1,
+        // so the index is converted to size_t and kVariantNPos with a single sign extension.
+        template <size_t AlternativesCount>
+        using VariantIndexType = std::conditional_t<(AlternativesCount <= std::numeric_limits<int8_t>::max()), int8_t,
+                std::conditional_t<(AlternativesCount <= std::numeric_limits<int16_t>::max()), int16_t, int32_t>>;
+
+        inline constexpr int kValuelessIndex = -1;
+
         template <bool TriviallyDestructible, typename... Ts>
         union MegaUnion {
             constexpr MegaUnion() = default;
@@ -44,7 +55,7 @@ namespace cpp::variant {
 
             template <typename... Args>
             constexpr T& ConstructInternalValue(InPlaceIndex<0>, Args&&... args) {
-                new (const_cast<std::remove_cv_t<T>*>(std::addressof(val))) T(std::forward<Args>(args)...);
+                std::construct_at(const_cast<std::remove_cv_t<T>*>(std::addressof(val)), std::forward<Args>(args)...);
                 return val;
             }
 
@@ -94,7 +105,7 @@ namespace cpp::variant {
 
             template <typename... Args>
             constexpr T& ConstructInternalValue(InPlaceIndex<0>, Args&&... args) {
-                new (const_cast<std::remove_cv_t<T>*>(std::addressof(val))) T(std::forward<Args>(args)...);
+                std::construct_at(const_cast<std::remove_cv_t<T>*>(std::addressof(val)), std::forward<Args>(args)...);
                 return val;
             }
 
@@ -125,7 +136,7 @@ namespace cpp::variant {
                 val.~T();
             }
 
-            ~MegaUnion() {}
+            constexpr ~MegaUnion() {}
 
         protected:
             T val;
@@ -143,14 +154,31 @@ namespace cpp::variant {
                     : val(ind, std::forward<Args>(args)...), ind(N) {}
 
             template <size_t N, typename... Args>
-            decltype(auto) ConstructInternalValue(InPlaceIndex<N> ind_, Args&&... args) {
+            constexpr decltype(auto) ConstructInternalValue(InPlaceIndex<N> ind_, Args&&... args) {
                 auto& res = val.ConstructInternalValue(ind_, std::forward<Args>(args)...);
                 ind = N;
                 return res;
             }
 
+            // For trivially copyable and assignable alternatives: the new value is built aside and the whole storage is copied,
+            // so there is no destruction and no valueless state in between
+            template <size_t N, typename... Args>
+            constexpr decltype(auto) AssignInternalValue(InPlaceIndex<N> ind_, Args&&... args) {
+                val = decltype(val)(ind_, std::forward<Args>(args)...);
+                ind = N;
+                return val.Get(ind_);
+            }
+
+            constexpr size_t StoredIndex() const noexcept {
+                return static_cast<size_t>(ind);
+            }
+
+            constexpr void StoreValueless() noexcept {
+                ind = kValuelessIndex;
+            }
+
             constexpr void DestroyInternalValue() {
-                if (ind != kVariantNPos) {
+                if (ind != kValuelessIndex) {
                     details::VisitIndex([this](auto ind_) { this->val.DestroyInternalValue(kInPlaceIndex<ind_()>); },
                             *static_cast<Variant<Ts...>*>(this));
                 }
@@ -160,7 +188,7 @@ namespace cpp::variant {
 
         protected:
             MegaUnion<(std::is_trivially_destructible_v<Ts> && ...), Ts...> val;
-            size_t ind{kVariantNPos};
+            VariantIndexType<sizeof...(Ts)> ind{kValuelessIndex};
         };
 
         template <typename... Ts>
@@ -174,14 +202,22 @@ namespace cpp::variant {
                     : val(ind, std::forward<Args>(args)...), ind(N) {}
 
             template <size_t N, typename... Args>
-            decltype(auto) ConstructInternalValue(InPlaceIndex<N> ind_, Args&&... args) {
+            constexpr decltype(auto) ConstructInternalValue(InPlaceIndex<N> ind_, Args&&... args) {
                 auto& res = val.ConstructInternalValue(ind_, std::forward<Args>(args)...);
                 ind = N;
                 return res;
             }
 
+            constexpr size_t StoredIndex() const noexcept {
+                return static_cast<size_t>(ind);
+            }
+
+            constexpr void StoreValueless() noexcept {
+                ind = kValuelessIndex;
+            }
+
             constexpr void DestroyInternalValue() {
-                if (ind != kVariantNPos) {
+                if (ind != kValuelessIndex) {
                     details::VisitIndex([this](auto ind_) { this->val.DestroyInternalValue(kInPlaceIndex<ind_()>); },
                                          *static_cast<Variant<Ts...>*>(this));
                 }
@@ -193,11 +229,111 @@ namespace cpp::variant {
 
         protected:
             MegaUnion<(std::is_trivially_destructible_v<Ts> && ...), Ts...> val;
-            size_t ind{kVariantNPos};
+            VariantIndexType<sizeof...(Ts)> ind{kValuelessIndex};
+        };
+
+        template <typename T>
+        concept IsNicheCarrier = NicheTraits<T>::kNicheCount >= 2 && std::is_trivially_copyable_v<T>;
+
+        template <typename T>
+        concept IsNicheEmpty = std::is_empty_v<T> && std::is_trivially_copyable_v<T> && !IsNicheCarrier<T>;
+
+        // The index of the alternative that carries the niches, kVariantNPos if the niche layout does not apply
+        template <typename... Ts>
+        inline constexpr size_t kNicheValueIndex = kVariantNPos;
+
+        template <IsNicheCarrier T, IsNicheEmpty E>
+        inline constexpr size_t kNicheValueIndex<T, E> = 0;
+
+        template <IsNicheEmpty E, IsNicheCarrier T>
+        inline constexpr size_t kNicheValueIndex<E, T> = 1;
+
+        template <size_t ValueIndex, typename T, typename E>
+        struct NicheValue {
+            template <size_t N>
+            constexpr auto& Get(InPlaceIndex<N>) noexcept {
+                if constexpr (N == ValueIndex) {
+                    return value;
+                } else {
+                    return empty;
+                }
+            }
+
+            template <size_t N>
+            constexpr const auto& Get(InPlaceIndex<N>) const noexcept {
+                if constexpr (N == ValueIndex) {
+                    return value;
+                } else {
+                    return empty;
+                }
+            }
+
+            T value;
+            [[no_unique_address]] E empty{};
+        };
+
+        // Storage of a variant of a niche carrier and an empty type: the first niche is the empty alternative,
+        // the second one is the valueless state
+        template <typename... Ts>
+        struct NicheVariantStorage {
+            static constexpr size_t kValueIndex = kNicheValueIndex<Ts...>;
+            static constexpr size_t kEmptyIndex = 1 - kValueIndex;
+            static constexpr size_t kEmptyNiche = 0;
+            static constexpr size_t kValuelessNiche = 1;
+
+            using ValueType = At<kValueIndex, Ts...>;
+            using EmptyType = At<kEmptyIndex, Ts...>;
+            using Traits = NicheTraits<ValueType>;
+
+            constexpr NicheVariantStorage() : val{MakeValue<0>()} {}
+
+            constexpr NicheVariantStorage(UninitializedStorageTag) noexcept : val{Traits::MakeNiche(kValuelessNiche)} {}
+
+            template <size_t N, typename... Args>
+            constexpr NicheVariantStorage(InPlaceIndex<N>, Args&&... args) : val{MakeValue<N>(std::forward<Args>(args)...)} {}
+
+            template <size_t N, typename... Args>
+            constexpr auto& ConstructInternalValue(InPlaceIndex<N> ind_, Args&&... args) {
+                val.value = MakeValue<N>(std::forward<Args>(args)...);
+                return val.Get(ind_);
+            }
+
+            template <size_t N, typename... Args>
+            constexpr auto& AssignInternalValue(InPlaceIndex<N> ind_, Args&&... args) {
+                return ConstructInternalValue(ind_, std::forward<Args>(args)...);
+            }
+
+            constexpr void DestroyInternalValue() noexcept {}
+
+            constexpr size_t StoredIndex() const noexcept {
+                const size_t niche = Traits::NicheIndex(val.value);
+                if (niche == Traits::kNicheCount) {
+                    return kValueIndex;
+                }
+                return niche == kEmptyNiche ? kEmptyIndex : kVariantNPos;
+            }
+
+            constexpr void StoreValueless() noexcept {
+                val.value = Traits::MakeNiche(kValuelessNiche);
+            }
+
+        protected:
+            template <size_t N, typename... Args>
+            static constexpr ValueType MakeValue(Args&&... args) {
+                if constexpr (N == kValueIndex) {
+                    return ValueType(std::forward<Args>(args)...);
+                } else {
+                    static_cast<void>(EmptyType(std::forward<Args>(args)...));
+                    return Traits::MakeNiche(kEmptyNiche);
+                }
+            }
+
+            NicheValue<kValueIndex, ValueType, EmptyType> val;
         };
 
         template <typename... Ts>
-        using VariantStorageType = VariantStorage<(std::is_trivially_destructible_v<Ts> && ...), Ts...>;
+        using VariantStorageType = std::conditional_t<kNicheValueIndex<Ts...> != kVariantNPos, NicheVariantStorage<Ts...>,
+                VariantStorage<(std::is_trivially_destructible_v<Ts> && ...), Ts...>>;
 
     } // End of namespace cpp::variant::details
 
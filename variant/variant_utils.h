@@ -1,6 +1,8 @@
 #ifndef CPP_IMPLEMENTATIONS_VARIANT_UTILS_H
 #define CPP_IMPLEMENTATIONS_VARIANT_UTILS_H
 
+#include <array>
+#include <cassert>
 #include <cstdint>
 #include <exception>
 #include <type_traits>
@@ -265,75 +267,309 @@ namespace cpp::variant {
 
     namespace details {
 
-        template <typename... Ts>
-        constexpr std::array<std::common_type_t<Ts...>, sizeof...(Ts)> MakeArray(Ts&&... t) noexcept {
-            return {std::forward<Ts>(t)...};
+        // Dispatch already knows the index of the alternative, so it reads the values without the checks of Get
+        struct VariantAccess {
+            template <size_t N, typename V>
+            static constexpr decltype(auto) Get(V&& v) noexcept {
+                if constexpr (std::is_lvalue_reference_v<V>) {
+                    return v.val.Get(kInPlaceIndex<N>);
+                } else {
+                    return std::move(v.val.Get(kInPlaceIndex<N>));
+                }
+            }
+        };
+
+        // Splits the index of a combination of alternatives into the indices of the alternatives, the last variant changes fastest
+        template <size_t... Sizes>
+        constexpr std::array<size_t, sizeof...(Sizes)> SplitCombinationIndex(size_t combination) noexcept {
+            constexpr std::array<size_t, sizeof...(Sizes)> kSizes{Sizes...};
+            std::array<size_t, sizeof...(Sizes)> indices{};
+            for (size_t i = sizeof...(Sizes); i-- > 0;) {
+                indices[i] = combination % kSizes[i];
+                combination /= kSizes[i];
+            }
+            return indices;
         }
 
-        template <typename F, typename... Vs, size_t... Inds>
-        constexpr auto GenFmatrixImpl(std::index_sequence<Inds...>) noexcept {
-            return [](F f, Vs... vs) { return std::invoke(std::forward<F>(f), Get<Inds>(std::forward<Vs>(vs))...); };
+        // A single flat array of function pointers with an entry for every combination of alternatives.
+        // With PassIndices the visitor gets std::integral_constant indices instead of the values.
+        template <bool PassIndices, typename R, typename F, typename... Vs>
+        struct DispatchTable {
+            using Entry = R (*)(F&&, Vs&&...);
+
+            static constexpr size_t kSize = (kVariantSizeValue<std::remove_reference_t<Vs>> * ... * 1);
+
+            template <size_t Combination, size_t... Positions>
+            static constexpr R CallImpl(std::index_sequence<Positions...>, F&& vis, Vs&&... variants) {
+                constexpr auto kIndices = SplitCombinationIndex<kVariantSizeValue<std::remove_reference_t<Vs>>...>(Combination);
+                if constexpr (PassIndices) {
+                    return std::invoke(std::forward<F>(vis), std::integral_constant<size_t, kIndices[Positions]>()...);
+                } else if constexpr (std::is_void_v<R>) {
+                    std::invoke(std::forward<F>(vis), VariantAccess::Get<kIndices[Positions]>(std::forward<Vs>(variants))...);
+                } else {
+                    return std::invoke(std::forward<F>(vis), VariantAccess::Get<kIndices[Positions]>(std::forward<Vs>(variants))...);
+                }
+            }
+
+            template <size_t Combination>
+            static constexpr R Call(F&& vis, Vs&&... variants) {
+                return CallImpl<Combination>(std::make_index_sequence<sizeof...(Vs)>(), std::forward<F>(vis), std::forward<Vs>(variants)...);
+            }
+
+            template <size_t... Combinations>
+            static constexpr std::array<Entry, kSize> MakeEntries(std::index_sequence<Combinations...>) noexcept {
+                return {&Call<Combinations>...};
+            }
+
+            static constexpr std::array<Entry, kSize> kEntries = MakeEntries(std::make_index_sequence<kSize>());
+
+            static constexpr size_t CombinationIndex(const std::remove_reference_t<Vs>&... variants) noexcept {
+                size_t combination = 0;
+                ((combination = combination * kVariantSizeValue<std::remove_reference_t<Vs>> + variants.Index()), ...);
+                return combination;
+            }
+        };
+
+        // Variants with up to this number of alternatives are dispatched with a switch,
+        // which the compiler can inline, unlike a call through the function pointer table
+        inline constexpr size_t kSwitchDispatchMaxAlternatives = 16;
+
+        // Nested switches are inlined into a single function, so the number of combinations is limited to keep compilation fast
+        inline constexpr size_t kSwitchDispatchMaxCombinations = 256;
+
+        template <typename... Vs>
+        inline constexpr bool kUseSwitchDispatch = ((kVariantSizeValue<std::remove_reference_t<Vs>> <= kSwitchDispatchMaxAlternatives) && ...)
+                && (kVariantSizeValue<std::remove_reference_t<Vs>> * ... * 1) <= kSwitchDispatchMaxCombinations;
+
+        [[noreturn]] inline void Unreachable() noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+            __builtin_unreachable();
+#endif
         }
 
-        template <typename F, size_t... Inds>
-        constexpr auto GenFmatrixIndexImpl(std::index_sequence<Inds...>) noexcept {
-            return [](F f) { return std::invoke(std::forward<F>(f), (std::integral_constant<size_t, Inds>())...); };
+        template <typename R, size_t N, size_t Count, typename F>
+        constexpr R SwitchCase(F& f) {
+            if constexpr (N < Count) {
+                return std::invoke(std::forward<F>(f), std::integral_constant<size_t, N>());
+            } else {
+                Unreachable();
+            }
         }
 
-        template <typename F, typename... Vs, size_t... FixedInds, size_t... NextInds, typename... RestInds>
-        constexpr auto GenFmatrixImpl(std::index_sequence<FixedInds...>, std::index_sequence<NextInds...>, RestInds... rInds) noexcept {
-            return MakeArray(GenFmatrixImpl<F, Vs...>(std::index_sequence<FixedInds..., NextInds>(), rInds...)...);
-        };
+        // Calls f(std::integral_constant<size_t, index>()), index must be less than Count
+        template <typename R, size_t Count, typename F>
+        constexpr R SwitchDispatch(size_t index, F&& f) {
+            static_assert(Count <= kSwitchDispatchMaxAlternatives);
+            assert(index < Count && "The index is out of range, the variant may be valueless");
+            switch (index) {
+                case 0: return SwitchCase<R, 0, Count>(f);
+                case 1: return SwitchCase<R, 1, Count>(f);
+                case 2: return SwitchCase<R, 2, Count>(f);
+                case 3: return SwitchCase<R, 3, Count>(f);
+                case 4: return SwitchCase<R, 4, Count>(f);
+                case 5: return SwitchCase<R, 5, Count>(f);
+                case 6: return SwitchCase<R, 6, Count>(f);
+                case 7: return SwitchCase<R, 7, Count>(f);
+                case 8: return SwitchCase<R, 8, Count>(f);
+                case 9: return SwitchCase<R, 9, Count>(f);
+                case 10: return SwitchCase<R, 10, Count>(f);
+                case 11: return SwitchCase<R, 11, Count>(f);
+                case 12: return SwitchCase<R, 12, Count>(f);
+                case 13: return SwitchCase<R, 13, Count>(f);
+                case 14: return SwitchCase<R, 14, Count>(f);
+                case 15: return SwitchCase<R, 15, Count>(f);
+                default: Unreachable();
+            }
+        }
 
-        template <typename F, size_t... FixedInds, size_t... NextInds, typename... RestInds>
-        constexpr auto GenFmatrixIndexImpl(std::index_sequence<FixedInds...>, std::index_sequence<NextInds...>, RestInds... rInds) noexcept {
-            return MakeArray(GenFmatrixIndexImpl<F>(std::index_sequence<FixedInds..., NextInds>(), rInds...)...);
-        };
+        template <typename F, size_t... Inds>
+        constexpr void InlineDispatchImpl(size_t index, F& f, std::index_sequence<Inds...>) {
+            static_cast<void>(((index == Inds && (std::invoke(f, std::integral_constant<size_t, Inds>()), true)) || ...));
+        }
 
-        template <typename F, typename... Vs>
-        constexpr auto GenFmatrix() noexcept {
-            return GenFmatrixImpl<F, Vs...>(std::index_sequence<>(), std::make_index_sequence<kVariantSizeValue<std::remove_reference_t<Vs>>>()...);
+        // Calls f(std::integral_constant<size_t, index>()) with any number of alternatives and without
+        // the function pointer table: a switch, or a chain of comparisons that the compiler turns into a jump table
+        template <size_t Count, typename F>
+        constexpr void InlineDispatch(size_t index, F&& f) {
+            if constexpr (Count <= kSwitchDispatchMaxAlternatives) {
+                SwitchDispatch<void, Count>(index, f);
+            } else {
+                InlineDispatchImpl(index, f, std::make_index_sequence<Count>());
+            }
         }
 
-        template <typename F, typename... Vs>
-        constexpr auto GenFmatrixIndex() noexcept {
-            return GenFmatrixIndexImpl<F>(std::index_sequence<>(), std::make_index_sequence<kVariantSizeValue<std::remove_reference_t<Vs>>>()...);
+        template <typename R, typename F, size_t... Inds>
+        constexpr R TableDispatch(size_t index, F& f, std::index_sequence<Inds...>) {
+            constexpr R (*kEntries[])(F&) = {[](F& function) -> R {
+                return std::invoke(function, std::integral_constant<size_t, Inds>());
+            }...};
+            return kEntries[index](f);
         }
 
-        template <typename T>
-        constexpr T& AtImpl(T& matrix) noexcept {
-            return matrix;
+        // Calls f(std::integral_constant<size_t, index>()) and returns its result, index must be less than Count.
+        // Like Visit, it uses a switch for up to 16 alternatives and a table of function pointers otherwise.
+        template <typename R, size_t Count, typename F>
+        constexpr R IndexDispatch(size_t index, F&& f) {
+            if constexpr (Count <= kSwitchDispatchMaxAlternatives) {
+                return SwitchDispatch<R, Count>(index, f);
+            } else {
+                return TableDispatch<R>(index, f, std::make_index_sequence<Count>());
+            }
         }
 
-        template <typename T, typename... Inds>
-        constexpr auto& AtImpl(T& matrix, size_t i, Inds... inds) noexcept {
-            return AtImpl(matrix[i], inds...);
+        template <typename R, typename F, size_t... FixedInds>
+        constexpr R SwitchVisitIndex(F&& vis, std::index_sequence<FixedInds...>) {
+            return std::invoke(std::forward<F>(vis), std::integral_constant<size_t, FixedInds>()...);
         }
 
-        template <typename T, typename... Inds>
-        constexpr auto& at(T& matrix, Inds... inds) noexcept {
-            return AtImpl(matrix, inds...);
+        // Dispatches on the variants one by one, collecting their indices in FixedInds
+        template <typename R, typename F, size_t... FixedInds, typename V, typename... Vs>
+        constexpr R SwitchVisitIndex(F&& vis, std::index_sequence<FixedInds...>, const V& variant, const Vs&... variants) {
+            return SwitchDispatch<R, kVariantSizeValue<V>>(variant.Index(), [&vis, &variants...](auto ind_) -> R {
+                return SwitchVisitIndex<R>(std::forward<F>(vis), std::index_sequence<FixedInds..., ind_()>(), variants...);
+            });
         }
 
         template <typename F, typename... Vs>
-        inline constexpr auto kFmatrix = GenFmatrix<F &&, Vs &&...>();
+        using VisitIndexResult = std::invoke_result_t<F, std::integral_constant<size_t, 0 * kVariantSizeValue<std::remove_reference_t<Vs>>>...>;
+
+        template <typename F, typename... Vs>
+        using VisitResult = std::invoke_result_t<F, decltype(VariantAccess::Get<0>(std::declval<Vs>()))...>;
 
         template <typename F, typename... Vs>
-        inline constexpr auto kFmatrixIndex = GenFmatrixIndex<F &&, Vs &&...>();
+        constexpr decltype(auto) TableVisitIndex(F&& vis, Vs&&... variants) {
+            using Table = DispatchTable<true, VisitIndexResult<F, Vs...>, F, Vs...>;
+            return Table::kEntries[Table::CombinationIndex(variants...)](std::forward<F>(vis), std::forward<Vs>(variants)...);
+        }
+
+        template <typename R, typename F, typename... Vs>
+        constexpr R TableVisit(F&& vis, Vs&&... variants) {
+            using Table = DispatchTable<false, R, F, Vs...>;
+            return Table::kEntries[Table::CombinationIndex(variants...)](std::forward<F>(vis), std::forward<Vs>(variants)...);
+        }
+
+        template <typename F, typename... Vs>
+        constexpr decltype(auto) TableVisit(F&& vis, Vs&&... variants) {
+            return TableVisit<VisitResult<F, Vs...>>(std::forward<F>(vis), std::forward<Vs>(variants)...);
+        }
 
         template <typename F, typename... Vs>
         constexpr decltype(auto) VisitIndex(F&& vis, Vs&&... variants) {
-            return at(kFmatrixIndex<F, Vs...>, variants.Index()...)(std::forward<F>(vis));
+            if constexpr (kUseSwitchDispatch<Vs...>) {
+                return SwitchVisitIndex<VisitIndexResult<F, Vs...>>(std::forward<F>(vis), std::index_sequence<>(), variants...);
+            } else {
+                return TableVisitIndex(std::forward<F>(vis), std::forward<Vs>(variants)...);
+            }
+        }
+
+        template <typename R, typename F, typename... Vs>
+        constexpr R VisitImpl(F&& vis, Vs&&... variants) {
+            if ((variants.ValuelessByException() || ...)) {
+                throw BadVariantAccess();
+            }
+            if constexpr (kUseSwitchDispatch<Vs...>) {
+                return SwitchVisitIndex<R>([&vis, &variants...](auto... inds_) -> R {
+                    if constexpr (std::is_void_v<R>) {
+                        std::invoke(std::forward<F>(vis), VariantAccess::Get<inds_()>(std::forward<Vs>(variants))...);
+                    } else {
+                        return std::invoke(std::forward<F>(vis), VariantAccess::Get<inds_()>(std::forward<Vs>(variants))...);
+                    }
+                }, std::index_sequence<>(), variants...);
+            } else {
+                return TableVisit<R>(std::forward<F>(vis), std::forward<Vs>(variants)...);
+            }
         }
 
     } // End of namespace cpp::variant::details
 
     template <typename F, typename... Vs>
     constexpr decltype(auto) Visit(F&& vis, Vs&&... variants) {
-        if ((variants.ValuelessByException() || ...)) {
-            throw BadVariantAccess();
+        return details::VisitImpl<details::VisitResult<F, Vs...>>(std::forward<F>(vis), std::forward<Vs>(variants)...);
+    }
+
+    // The result of the visitor is converted to R, or discarded if R is void
+    template <typename R, typename F, typename... Vs>
+    constexpr R Visit(F&& vis, Vs&&... variants) {
+        return details::VisitImpl<R>(std::forward<F>(vis), std::forward<Vs>(variants)...);
+    }
+
+
+    // Combines the given functors into a single one that has all their operator()s
+    template <typename... Fs>
+    struct Overloaded : Fs... {
+        using Fs::operator()...;
+    };
+
+    template <typename... Fs>
+    Overloaded(Fs...) -> Overloaded<Fs...>;
+
+
+    namespace details {
+
+        template <typename F, typename V, size_t... Inds>
+        constexpr bool IsExhaustiveMatchImpl(std::index_sequence<Inds...>) noexcept {
+            return (std::is_invocable_v<F, decltype(VariantAccess::Get<Inds>(std::declval<V>()))> && ...);
+        }
+
+        // Every alternative of the variant can be passed to the functor
+        template <typename F, typename V>
+        inline constexpr bool kIsExhaustiveMatch = IsExhaustiveMatchImpl<F, V>(std::make_index_sequence<kVariantSizeValue<std::remove_reference_t<V>>>());
+
+        // References are kept when all the results have the same type
+        template <typename R, typename... Rs>
+        struct CommonResult {
+            using Type = std::conditional_t<(std::is_same_v<R, Rs> && ...), R, std::common_type_t<R, Rs...>>;
+        };
+
+        template <typename F, typename V, size_t... Inds>
+        typename CommonResult<std::invoke_result_t<F, decltype(VariantAccess::Get<Inds>(std::declval<V>()))>...>::Type MatchResultImpl(std::index_sequence<Inds...>);
+
+        // The result for all alternatives or their common type
+        template <typename F, typename V>
+        using MatchResult = decltype(MatchResultImpl<F, V>(std::make_index_sequence<kVariantSizeValue<std::remove_reference_t<V>>>()));
+
+        template <typename R, size_t Likely, typename F, typename V>
+        constexpr R MatchImpl(F& function, V&& variant) {
+            constexpr size_t kCount = kVariantSizeValue<std::remove_reference_t<V>>;
+            if (variant.ValuelessByException()) {
+                throw BadVariantAccess();
+            }
+            if constexpr (Likely != kVariantNPos) {
+                static_assert(Likely < kCount, "The likely alternative is out of range");
+                if (variant.Index() == Likely) [[likely]] {
+                    return std::invoke(function, VariantAccess::Get<Likely>(std::forward<V>(variant)));
+                }
+            }
+            if constexpr (kCount <= kSwitchDispatchMaxAlternatives) {
+                return SwitchDispatch<R, kCount>(variant.Index(), [&function, &variant](auto ind_) -> R {
+                    return std::invoke(function, VariantAccess::Get<ind_()>(std::forward<V>(variant)));
+                });
+            } else {
+                return TableVisit<R>(function, std::forward<V>(variant));
+            }
         }
-        return at(details::kFmatrix<F, Vs...>, variants.Index()...)(std::forward<F>(vis), std::forward<Vs>(variants)...);
+
+    } // End of namespace cpp::variant::details
+
+    // Calls the functor of the overload set built from functions that accepts the value held by the variant.
+    // Every alternative must be handled, which is checked at compile time. The result is the common type
+    // of the results for all alternatives, or their type if it is the same.
+    template <typename V, typename... Fs>
+    constexpr decltype(auto) Match(V&& variant, Fs&&... functions) requires(sizeof...(Fs) > 0) {
+        using Functions = Overloaded<std::decay_t<Fs>...>;
+        static_assert(details::kIsExhaustiveMatch<Functions&, V>, "Match does not handle every alternative of the variant");
+        Functions overloaded{std::forward<Fs>(functions)...};
+        return details::MatchImpl<details::MatchResult<Functions&, V>, kVariantNPos>(overloaded, std::forward<V>(variant));
+    }
+
+    // Match that checks the N-th alternative first and marks it as the likely one,
+    // so the hot alternative is handled on the fall-through path before the switch
+    template <size_t N, typename V, typename... Fs>
+    constexpr decltype(auto) MatchLikely(V&& variant, Fs&&... functions) requires(sizeof...(Fs) > 0) {
+        using Functions = Overloaded<std::decay_t<Fs>...>;
+        static_assert(details::kIsExhaustiveMatch<Functions&, V>, "Match does not handle every alternative of the variant");
+        Functions overloaded{std::forward<Fs>(functions)...};
+        return details::MatchImpl<details::MatchResult<Functions&, V>, N>(overloaded, std::forward<V>(variant));
     }
 
 } // End of namespace cpp::variant
@@ -0,0 +1,299 @@
+#ifndef CPP_IMPLEMENTATIONS_VARIANT_VECTOR_H
+#define CPP_IMPLEMENTATIONS_VARIANT_VECTOR_H
+
+#include <array>
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "variant.h"
+
+namespace cpp::variant {
+
+    namespace details {
+
+        // std::vector<bool> packs the values into bits and returns proxies instead of bool&,
+        // so the values of a bool alternative are kept in this array of one byte per value.
+        // It provides the part of the std::vector interface used by VariantVector.
+        class BoolArray {
+        public:
+            template <typename... Args>
+            bool& emplace_back(Args&&... args);
+
+            void pop_back() noexcept {
+                size_--;
+            }
+
+            void clear() noexcept {
+                size_ = 0;
+            }
+
+            [[nodiscard]] bool& back() noexcept {
+                return values_[size_ - 1];
+            }
+
+            [[nodiscard]] bool& operator[](size_t position) noexcept {
+                return values_[position];
+            }
+
+            [[nodiscard]] const bool& operator[](size_t position) const noexcept {
+                return values_[position];
+            }
+
+            [[nodiscard]] bool* data() noexcept {
+                return values_.get();
+            }
+
+            [[nodiscard]] const bool* data() const noexcept {
+                return values_.get();
+            }
+
+            [[nodiscard]] size_t size() const noexcept {
+                return size_;
+            }
+
+            [[nodiscard]] bool* begin() noexcept {
+                return data();
+            }
+
+            [[nodiscard]] bool* end() noexcept {
+                return data() + size_;
+            }
+
+            [[nodiscard]] const bool* begin() const noexcept {
+                return data();
+            }
+
+            [[nodiscard]] const bool* end() const noexcept {
+                return data() + size_;
+            }
+
+        private:
+            static constexpr size_t kMinCapacity = 16;
+
+            std::unique_ptr<bool[]> values_;
+            size_t size_{0};
+            size_t capacity_{0};
+        };
+
+        template <typename T>
+        using DenseArray = std::conditional_t<std::is_same_v<T, bool>, BoolArray, std::vector<T>>;
+
+    } // End of namespace details
+
+
+    // Sequence of variants stored as a structure of arrays: the indices of the alternatives are kept
+    // in a compact array and the values of every alternative in their own dense array, so no value is padded
+    // to the largest alternative. VisitAll processes the values alternative by alternative,
+    // so the visitor call is monomorphic within an array and can be vectorized.
+    template <typename... Ts>
+    requires (sizeof...(Ts) > 0)
+    class VariantVector {
+    public:
+        using IndexType = details::VariantIndexType<sizeof...(Ts)>;
+
+        VariantVector() = default;
+
+        template <typename T, size_t Index = details::kFindInPackValue<std::remove_cvref_t<T>, Ts...>>
+        void PushBack(T&& value) requires(details::kOccursOnlyOnceValue<std::remove_cvref_t<T>, Ts...>);
+
+        // Throws BadVariantAccess if the variant is valueless
+        void PushBack(const Variant<Ts...>& variant);
+
+        template <size_t N, typename... Args>
+        details::At<N, Ts...>& Emplace(Args&&... args);
+
+        void Reserve(size_t size);
+        void Clear() noexcept;
+
+        [[nodiscard]] size_t Size() const noexcept;
+        [[nodiscard]] bool IsEmpty() const noexcept;
+
+        [[nodiscard]] size_t Index(size_t position) const noexcept;
+
+        // Returns the dense array of the values of the N-th alternative
+        template <size_t N>
+        std::span<details::At<N, Ts...>> Alternative() noexcept;
+
+        template <size_t N>
+        std::span<const details::At<N, Ts...>> Alternative() const noexcept;
+
+        // Calls function(T&) for every value, alternative by alternative. The order of the values is not preserved.
+        template <typename F>
+        void VisitAll(F&& function);
+
+        template <typename F>
+        void VisitAll(F&& function) const;
+
+        // Calls function(T&) for every value in the order of insertion
+        template <typename F>
+        void ForEach(F&& function);
+
+        template <typename F>
+        void ForEach(F&& function) const;
+
+    private:
+        template <typename Self, typename F, size_t... Inds>
+        static void VisitAllImpl(Self& self, F& function, std::index_sequence<Inds...>);
+
+        template <typename Self, typename F>
+        static void ForEachImpl(Self& self, F& function);
+
+    private:
+        std::vector<IndexType> indices_;
+        std::tuple<details::DenseArray<Ts>...> values_;
+    };
+
+
+    // Implementation
+    template <typename... Args>
+    bool& details::BoolArray::emplace_back(Args&&... args) {
+        const bool value(std::forward<Args>(args)...);
+        if (size_ == capacity_) {
+            const size_t capacity = std::max(2 * capacity_, kMinCapacity);
+            auto values = std::make_unique_for_overwrite<bool[]>(capacity);
+            std::copy(begin(), end(), values.get());
+            values_ = std::move(values);
+            capacity_ = capacity;
+        }
+        values_[size_] = value;
+        return values_[size_++];
+    }
+
+    template <typename... Ts>
+    requires (sizeof...(Ts) > 0)
+    template <typename T, size_t Index>
+    void VariantVector<Ts...>::PushBack(T&& value) requires(details::kOccursOnlyOnceValue<std::remove_cvref_t<T>, Ts...>) {
+        Emplace<Index>(std::forward<T>(value));
+    }
+
+    template <typename... Ts>
+    requires (sizeof...(Ts) > 0)
+    void VariantVector<Ts...>::PushBack(const Variant<Ts...>& variant) {
+        if (variant.ValuelessByException()) {
+            throw BadVariantAccess("Valueless variant can not be stored in VariantVector");
+        }
+        details::VisitIndex([this, &variant](auto ind_) {
+            Emplace<ind_()>(Get<ind_()>(variant));
+        }, variant);
+    }
+
+    template <typename... Ts>
+    requires (sizeof...(Ts) > 0)
+    template <size_t N, typename... Args>
+    details::At<N, Ts...>& VariantVector<Ts...>::Emplace(Args&&... args) {
+        auto& values = std::get<N>(values_);
+        values.emplace_back(std::forward<Args>(args)...);
+        try {
+            indices_.push_back(static_cast<IndexType>(N));
+        } catch (...) {
+            values.pop_back();
+            throw;
+        }
+        return values.back();
+    }
+
+    template <typename... Ts>
+    requires (sizeof...(Ts) > 0)
+    void VariantVector<Ts...>::Reserve(size_t size) {
+        indices_.reserve(size);
+    }
+
+    template <typename... Ts>
+    requires (sizeof...(Ts) > 0)
+    void VariantVector<Ts...>::Clear() noexcept {
+        indices_.clear();
+        std::apply([](auto&... values) { (values.clear(), ...); }, values_);
+    }
+
+    template <typename... Ts>
+    requires (sizeof...(Ts) > 0)
+    size_t VariantVector<Ts...>::Size() const noexcept {
+        return indices_.size();
+    }
+
+    template <typename... Ts>
+    requires (sizeof...(Ts) > 0)
+    bool VariantVector<Ts...>::IsEmpty() const noexcept {
+        return indices_.empty();
+    }
+
+    template <typename... Ts>
+    requires (sizeof...(Ts) > 0)
+    size_t VariantVector<Ts...>::Index(size_t position) const noexcept {
+        return static_cast<size_t>(indices_[position]);
+    }
+
+    template <typename... Ts>
+    requires (sizeof...(Ts) > 0)
+    template <size_t N>
+    std::span<details::At<N, Ts...>> VariantVector<Ts...>::Alternative() noexcept {
+        return std::get<N>(values_);
+    }
+
+    template <typename... Ts>
+    requires (sizeof...(Ts) > 0)
+    template <size_t N>
+    std::span<const details::At<N, Ts...>> VariantVector<Ts...>::Alternative() const noexcept {
+        return std::get<N>(values_);
+    }
+
+    template <typename... Ts>
+    requires (sizeof...(Ts) > 0)
+    template <typename F>
+    void VariantVector<Ts...>::VisitAll(F&& function) {
+        VisitAllImpl(*this, function, std::index_sequence_for<Ts...>());
+    }
+
+    template <typename... Ts>
+    requires (sizeof...(Ts) > 0)
+    template <typename F>
+    void VariantVector<Ts...>::VisitAll(F&& function) const {
+        VisitAllImpl(*this, function, std::index_sequence_for<Ts...>());
+    }
+
+    template <typename... Ts>
+    requires (sizeof...(Ts) > 0)
+    template <typename F>
+    void VariantVector<Ts...>::ForEach(F&& function) {
+        ForEachImpl(*this, function);
+    }
+
+    template <typename... Ts>
+    requires (sizeof...(Ts) > 0)
+    template <typename F>
+    void VariantVector<Ts...>::ForEach(F&& function) const {
+        ForEachImpl(*this, function);
+    }
+
+    template <typename... Ts>
+    requires (sizeof...(Ts) > 0)
+    template <typename Self, typename F, size_t... Inds>
+    void VariantVector<Ts...>::VisitAllImpl(Self& self, F& function, std::index_sequence<Inds...>) {
+        ([&self, &function] {
+            for (auto& value : std::get<Inds>(self.values_)) {
+                function(value);
+            }
+        }(), ...);
+    }
+
+    template <typename... Ts>
+    requires (sizeof...(Ts) > 0)
+    template <typename Self, typename F>
+    void VariantVector<Ts...>::ForEachImpl(Self& self, F& function) {
+        // The next value of every alternative
+        std::array<size_t, sizeof...(Ts)> positions{};
+        for (const IndexType index : self.indices_) {
+            details::InlineDispatch<sizeof...(Ts)>(static_cast<size_t>(index), [&self, &function, &positions](auto ind_) {
+                function(std::get<ind_()>(self.values_)[positions[ind_()]++]);
+            });
+        }
+    }
+
+} // End of namespace cpp::variant
+
+#endif //CPP_IMPLEMENTATIONS_VARIANT_VECTOR_H